@@ -253,8 +253,11 @@ void UAlsAnimationInstance::RefreshMovementBaseOnGameThread()
 
 	const auto PreviousRotation{MovementBase.Rotation};
 
-	MovementBaseUtility::GetMovementBaseTransform(BasedMovement.MovementBase, BasedMovement.BoneName,
-	                                              MovementBase.Location, MovementBase.Rotation);
+	if (!Character->TryGetCurrentMovementBaseTransform(MovementBase.Location, MovementBase.Rotation))
+	{
+		MovementBaseUtility::GetMovementBaseTransform(BasedMovement.MovementBase, BasedMovement.BoneName,
+		                                              MovementBase.Location, MovementBase.Rotation);
+	}
 
 	MovementBase.DeltaRotation = MovementBase.bHasRelativeLocation && !MovementBase.bBaseChanged
 		                             ? (MovementBase.Rotation * PreviousRotation.Inverse()).Rotator()
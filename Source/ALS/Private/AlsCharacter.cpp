@@ -2,6 +2,7 @@
 
 #include "AlsAnimationInstance.h"
 #include "AlsCharacterMovementComponent.h"
+#include "AlsRewindSubsystem.h"
 #include "TimerManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
@@ -13,6 +14,7 @@
 #include "Settings/AlsCharacterSettings.h"
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsMacros.h"
+#include "Utility/AlsNetworkStats.h"
 #include "Utility/AlsRotation.h"
 #include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
@@ -89,10 +91,71 @@ void AAlsCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, OverlayMode, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, FlightMode, Parameters)
 
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplicatedViewRotation, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, InputDirection, Parameters)
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, JumpsCount, Parameters)
+
+	// These properties change too frequently, so replays record the more compact replay state instead.
+
+	Parameters.Condition = COND_SimulatedOnlyNoReplay;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplicatedViewRotation, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredVelocityYawAngle, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, RagdollTargetLocation, Parameters)
+
+	Parameters.Condition = COND_ReplayOnly;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplayState, Parameters)
+
+	Parameters.Condition = COND_None;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, NetworkAction, Parameters)
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, MantlingSettingsTable, Parameters)
+}
+
+bool AAlsCharacter::IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const
+{
+	// Unreliable multicast functions are only sent to connections for which the actor is relevant,
+	// so use this to additionally limit the distance at which action events are sent.
+
+	if (bSendingNetworkActionEvent && IsValid(Settings) && Settings->NetworkActions.EventCullDistance > 0.0f &&
+	    FVector::DistSquared(SrcLocation, GetActorLocation()) > FMath::Square(Settings->NetworkActions.EventCullDistance))
+	{
+		return false;
+	}
+
+	return Super::IsNetRelevantFor(RealViewer, ViewTarget, SrcLocation);
+}
+
+void AAlsCharacter::PreReplicationForReplay(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplicationForReplay(ChangedPropertyTracker);
+
+	// Quantize the values the same way they are serialized, so that the replay state is marked
+	// dirty only when the change is actually noticeable, and not every time the values change.
+
+	const FRotator NewViewRotation{
+		FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(ReplicatedViewRotation.Pitch)),
+		FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(ReplicatedViewRotation.Yaw)),
+		0.0f
+	};
+
+	const auto NewDesiredVelocityYawAngle{FRotator::CompressAxisToShort(DesiredVelocityYawAngle)};
+
+	// Matches the precision of FVector_NetQuantize serialization.
+
+	const FVector NewRagdollTargetLocation{
+		FMath::RoundToDouble(RagdollTargetLocation.X),
+		FMath::RoundToDouble(RagdollTargetLocation.Y),
+		FMath::RoundToDouble(RagdollTargetLocation.Z)
+	};
+
+	if (ReplayState.ViewRotation != NewViewRotation ||
+	    ReplayState.DesiredVelocityYawAngle != NewDesiredVelocityYawAngle ||
+	    ReplayState.RagdollTargetLocation != NewRagdollTargetLocation)
+	{
+		ReplayState.ViewRotation = NewViewRotation;
+		ReplayState.DesiredVelocityYawAngle = NewDesiredVelocityYawAngle;
+		ReplayState.RagdollTargetLocation = NewRagdollTargetLocation;
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplayState, this)
+	}
 }
 
 void AAlsCharacter::PreRegisterAllComponents()
@@ -181,6 +244,16 @@ void AAlsCharacter::BeginPlay()
 	ViewState.NetworkSmoothing.bEnabled |= IsValid(Settings) &&
 		Settings->View.bEnableNetworkSmoothing && GetLocalRole() == ROLE_SimulatedProxy;
 
+	if (IsValid(Settings) && Settings->Rewind.bEnableRewindHistory && GetLocalRole() >= ROLE_Authority)
+	{
+		auto* RewindSubsystem{GetWorld()->GetSubsystem<UAlsRewindSubsystem>()};
+		if (IsValid(RewindSubsystem))
+		{
+			RewindHistory.Initialize(FMath::CeilToInt32(Settings->Rewind.HistoryDuration * Settings->Rewind.MaxRecordRate) + 1);
+			RewindSubsystem->RegisterCharacter(this);
+		}
+	}
+
 	// Update states to use the initial desired values.
 
 	ApplyDesiredStance();
@@ -290,18 +363,38 @@ void AAlsCharacter::Tick(const float DeltaTime)
 		return;
 	}
 
-	RefreshMovementBase();
+	RefreshReducedProxyUpdates();
 
-	RefreshMeshProperties();
+	// Distant simulated proxies refresh their state at a reduced rate, using the time elapsed since the last refresh as
+	// the delta time, so that the interpolations still converge at the same speed, only in fewer and larger steps. The
+	// rotation is still refreshed every frame, since it is cheap and would otherwise visibly step, unlike the location,
+	// which is smoothed by the movement component regardless.
 
-	RefreshInput(DeltaTime);
+	PendingRefreshDeltaTime += DeltaTime;
 
-	RefreshLocomotionEarly();
+	const auto bRefreshState{
+		!bReducedProxyUpdates || PendingRefreshDeltaTime >= 1.0f / Settings->Proxy.ReducedUpdatesFrequency
+	};
 
-	RefreshView(DeltaTime);
-	RefreshLocomotion();
-	RefreshGait();
-	RefreshRotationMode();
+	const auto RefreshDeltaTime{PendingRefreshDeltaTime};
+
+	if (bRefreshState)
+	{
+		PendingRefreshDeltaTime = 0.0f;
+
+		RefreshMovementBase();
+
+		RefreshMeshProperties();
+
+		RefreshInput(RefreshDeltaTime);
+
+		RefreshLocomotionEarly();
+
+		RefreshView(RefreshDeltaTime);
+		RefreshLocomotion();
+		RefreshGait();
+		RefreshRotationMode();
+	}
 
 	// Each of these checks themselves for the correct locomotion mode and will return silently if we aren't in it.
 	RefreshGroundedRotation(DeltaTime);
@@ -311,9 +404,13 @@ void AAlsCharacter::Tick(const float DeltaTime)
 
 	StartMantlingGrounded();
 	StartMantlingInAir();
-	RefreshMantling();
-	RefreshRagdolling(DeltaTime);
-	RefreshRolling(DeltaTime);
+
+	if (bRefreshState)
+	{
+		RefreshMantling();
+		RefreshRagdolling(RefreshDeltaTime);
+		RefreshRolling(RefreshDeltaTime);
+	}
 
 	Super::Tick(DeltaTime);
 
@@ -439,14 +536,63 @@ void AAlsCharacter::RefreshMovementBase()
 
 	const auto PreviousRotation{MovementBase.Rotation};
 
-	MovementBaseUtility::GetMovementBaseTransform(BasedMovement.MovementBase, BasedMovement.BoneName,
-	                                              MovementBase.Location, MovementBase.Rotation);
+	if (!TryGetCurrentMovementBaseTransform(MovementBase.Location, MovementBase.Rotation))
+	{
+		MovementBaseUtility::GetMovementBaseTransform(BasedMovement.MovementBase, BasedMovement.BoneName,
+		                                              MovementBase.Location, MovementBase.Rotation);
+	}
 
 	MovementBase.DeltaRotation = MovementBase.bHasRelativeLocation && !MovementBase.bBaseChanged
 		                             ? (MovementBase.Rotation * PreviousRotation.Inverse()).Rotator()
 		                             : FRotator::ZeroRotator;
 }
 
+void AAlsCharacter::RefreshMovementBaseSnapshot()
+{
+	auto& Snapshot{MovementBaseSnapshot};
+
+	if (BasedMovement.MovementBase != Snapshot.Primitive || BasedMovement.BoneName != Snapshot.BoneName)
+	{
+		Snapshot.Primitive = BasedMovement.MovementBase;
+		Snapshot.BoneName = BasedMovement.BoneName;
+		Snapshot.bBaseChanged = true;
+	}
+	else
+	{
+		Snapshot.bBaseChanged = false;
+	}
+
+	Snapshot.bHasRelativeLocation = BasedMovement.HasRelativeLocation();
+	Snapshot.bHasRelativeRotation = Snapshot.bHasRelativeLocation && BasedMovement.bRelativeRotation;
+
+	const auto PreviousRotation{Snapshot.Rotation};
+
+	MovementBaseUtility::GetMovementBaseTransform(BasedMovement.MovementBase, BasedMovement.BoneName,
+	                                              Snapshot.Location, Snapshot.Rotation);
+
+	Snapshot.DeltaRotation = Snapshot.bHasRelativeLocation && !Snapshot.bBaseChanged
+		                         ? (Snapshot.Rotation * PreviousRotation.Inverse()).Rotator()
+		                         : FRotator::ZeroRotator;
+
+	Snapshot.FrameNumber = GFrameCounter;
+}
+
+bool AAlsCharacter::TryGetCurrentMovementBaseTransform(FVector& OutLocation, FQuat& OutRotation) const
+{
+	// The snapshot is only valid for the frame in which it was taken and only as long as the movement base remains the same.
+
+	if (MovementBaseSnapshot.FrameNumber != GFrameCounter ||
+	    MovementBaseSnapshot.Primitive != BasedMovement.MovementBase ||
+	    MovementBaseSnapshot.BoneName != BasedMovement.BoneName)
+	{
+		return false;
+	}
+
+	OutLocation = MovementBaseSnapshot.Location;
+	OutRotation = MovementBaseSnapshot.Rotation;
+	return true;
+}
+
 void AAlsCharacter::SetViewMode(const FGameplayTag& NewViewMode)
 {
 	SetViewMode(NewViewMode, true);
@@ -478,11 +624,15 @@ void AAlsCharacter::SetViewMode(const FGameplayTag& NewViewMode, const bool bSen
 
 void AAlsCharacter::ClientSetViewMode_Implementation(const FGameplayTag& NewViewMode)
 {
+	ALS_COUNT_RPC(ClientSetViewMode);
+
 	SetViewMode(NewViewMode, false);
 }
 
 void AAlsCharacter::ServerSetViewMode_Implementation(const FGameplayTag& NewViewMode)
 {
+	ALS_COUNT_RPC(ServerSetViewMode);
+
 	SetViewMode(NewViewMode, false);
 }
 
@@ -630,11 +780,15 @@ void AAlsCharacter::SetDesiredAiming(const bool bNewDesiredAiming, const bool bS
 
 void AAlsCharacter::ClientSetDesiredAiming_Implementation(const bool bNewDesiredAiming)
 {
+	ALS_COUNT_RPC(ClientSetDesiredAiming);
+
 	SetDesiredAiming(bNewDesiredAiming, false);
 }
 
 void AAlsCharacter::ServerSetDesiredAiming_Implementation(const bool bNewDesiredAiming)
 {
+	ALS_COUNT_RPC(ServerSetDesiredAiming);
+
 	SetDesiredAiming(bNewDesiredAiming, false);
 }
 
@@ -677,11 +831,15 @@ void AAlsCharacter::SetDesiredRotationMode(const FGameplayTag& NewDesiredRotatio
 
 void AAlsCharacter::ClientSetDesiredRotationMode_Implementation(const FGameplayTag& NewDesiredRotationMode)
 {
+	ALS_COUNT_RPC(ClientSetDesiredRotationMode);
+
 	SetDesiredRotationMode(NewDesiredRotationMode, false);
 }
 
 void AAlsCharacter::ServerSetDesiredRotationMode_Implementation(const FGameplayTag& NewDesiredRotationMode)
 {
+	ALS_COUNT_RPC(ServerSetDesiredRotationMode);
+
 	SetDesiredRotationMode(NewDesiredRotationMode, false);
 }
 
@@ -827,11 +985,15 @@ void AAlsCharacter::SetDesiredStance(const FGameplayTag& NewDesiredStance, const
 
 void AAlsCharacter::ClientSetDesiredStance_Implementation(const FGameplayTag& NewDesiredStance)
 {
+	ALS_COUNT_RPC(ClientSetDesiredStance);
+
 	SetDesiredStance(NewDesiredStance, false);
 }
 
 void AAlsCharacter::ServerSetDesiredStance_Implementation(const FGameplayTag& NewDesiredStance)
 {
+	ALS_COUNT_RPC(ServerSetDesiredStance);
+
 	SetDesiredStance(NewDesiredStance, false);
 }
 
@@ -960,11 +1122,15 @@ void AAlsCharacter::SetDesiredGait(const FGameplayTag& NewDesiredGait, const boo
 
 void AAlsCharacter::ClientSetDesiredGait_Implementation(const FGameplayTag& NewDesiredGait)
 {
+	ALS_COUNT_RPC(ClientSetDesiredGait);
+
 	SetDesiredGait(NewDesiredGait, false);
 }
 
 void AAlsCharacter::ServerSetDesiredGait_Implementation(const FGameplayTag& NewDesiredGait)
 {
+	ALS_COUNT_RPC(ServerSetDesiredGait);
+
 	SetDesiredGait(NewDesiredGait, false);
 }
 
@@ -1105,11 +1271,15 @@ void AAlsCharacter::SetOverlayMode(const FGameplayTag& NewOverlayMode, const boo
 
 void AAlsCharacter::ClientSetOverlayMode_Implementation(const FGameplayTag& NewOverlayMode)
 {
+	ALS_COUNT_RPC(ClientSetOverlayMode);
+
 	SetOverlayMode(NewOverlayMode, false);
 }
 
 void AAlsCharacter::ServerSetOverlayMode_Implementation(const FGameplayTag& NewOverlayMode)
 {
+	ALS_COUNT_RPC(ServerSetOverlayMode);
+
 	SetOverlayMode(NewOverlayMode, false);
 }
 
@@ -1139,6 +1309,8 @@ void AAlsCharacter::NotifyLocomotionActionChanged(const FGameplayTag& PreviousLo
 		AlsCharacterMovement->SetInputBlocked(false);
 	}
 
+	RefreshNetworkActionOnLocomotionActionChanged();
+
 	ApplyDesiredStance();
 
 	OnLocomotionActionChanged(PreviousLocomotionAction);
@@ -1188,6 +1360,8 @@ void AAlsCharacter::SetReplicatedViewRotation(const FRotator& NewViewRotation, c
 
 void AAlsCharacter::ServerSetReplicatedViewRotation_Implementation(const FRotator& NewViewRotation)
 {
+	ALS_COUNT_RPC(ServerSetReplicatedViewRotation);
+
 	SetReplicatedViewRotation(NewViewRotation, false);
 }
 
@@ -1196,12 +1370,25 @@ void AAlsCharacter::OnReplicated_ReplicatedViewRotation()
 	CorrectViewNetworkSmoothing(ReplicatedViewRotation, MovementBase.bHasRelativeRotation);
 }
 
+void AAlsCharacter::OnReplicated_ReplayState()
+{
+	// Replays don't record the properties mirrored by the replay state, so restore them from it.
+
+	ReplicatedViewRotation = ReplayState.ViewRotation;
+	DesiredVelocityYawAngle = UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(FRotator::DecompressAxisFromShort(ReplayState.DesiredVelocityYawAngle)));
+	RagdollTargetLocation = ReplayState.RagdollTargetLocation;
+
+	OnReplicated_ReplicatedViewRotation();
+}
+
 void AAlsCharacter::CorrectViewNetworkSmoothing(const FRotator& NewTargetRotation, const bool bRotationIsBaseRelative)
 {
 	// Based on UCharacterMovementComponent::SmoothCorrection().
 
 	auto& NetworkSmoothing{ViewState.NetworkSmoothing};
 
+	const auto PreviousTargetRotation{NetworkSmoothing.TargetRotation};
+
 	NetworkSmoothing.TargetRotation = bRotationIsBaseRelative
 		                                  ? (MovementBase.Rotation * NewTargetRotation.Quaternion()).Rotator()
 		                                  : NewTargetRotation.GetNormalized();
@@ -1238,6 +1425,21 @@ void AAlsCharacter::CorrectViewNetworkSmoothing(const FRotator& NewTargetRotatio
 
 	const auto MaxServerDeltaTime{GetDefault<AGameNetworkManager>()->MaxClientSmoothingDeltaTime};
 
+	// Estimate the angular velocity of the view from the last two server updates. If too much time has
+	// passed between them, then the estimate is unreliable, so in this case don't extrapolate at all.
+
+	if (ServerDeltaTime > UE_SMALL_NUMBER && ServerDeltaTime <= MaxServerDeltaTime)
+	{
+		NetworkSmoothing.AngularVelocity = (NetworkSmoothing.TargetRotation - PreviousTargetRotation).GetNormalized() * (1.0f / ServerDeltaTime);
+		NetworkSmoothing.AngularVelocity.Roll = 0.0f;
+	}
+	else
+	{
+		NetworkSmoothing.AngularVelocity = FRotator::ZeroRotator;
+	}
+
+	NetworkSmoothing.ExtrapolationTime = 0.0f;
+
 	const auto MinServerDeltaTime{
 		FMath::Min(MaxServerDeltaTime, bListenServer
 			                               ? GetCharacterMovement()->ListenServerNetworkSimulatedSmoothLocationTime
@@ -1311,9 +1513,16 @@ void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
 
 	auto& NetworkSmoothing{ViewState.NetworkSmoothing};
 
-	if (!NetworkSmoothing.bEnabled ||
-	    NetworkSmoothing.ClientTime >= NetworkSmoothing.ServerTime ||
-	    NetworkSmoothing.Duration <= UE_SMALL_NUMBER ||
+	const auto bExtrapolationAllowed{
+		NetworkSmoothing.bEnabled && IsValid(Settings) && Settings->View.bEnableNetworkExtrapolation &&
+		Settings->View.MaxNetworkExtrapolationTime > UE_SMALL_NUMBER
+	};
+
+	const auto bInterpolating{NetworkSmoothing.ClientTime < NetworkSmoothing.ServerTime && NetworkSmoothing.Duration > UE_SMALL_NUMBER};
+
+	// Reduced proxy updates skip network smoothing and use the replicated view rotation as is.
+
+	if (!NetworkSmoothing.bEnabled || bReducedProxyUpdates || (!bInterpolating && !bExtrapolationAllowed) ||
 	    (MovementBase.bHasRelativeRotation && IsNetMode(NM_ListenServer)))
 	{
 		// Can't use network smoothing on the listen server when the character
@@ -1325,6 +1534,7 @@ void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
 
 		NetworkSmoothing.TargetRotation = NetworkSmoothing.InitialRotation;
 		NetworkSmoothing.CurrentRotation = NetworkSmoothing.InitialRotation;
+		NetworkSmoothing.ExtrapolationTime = 0.0f;
 
 		return;
 	}
@@ -1346,22 +1556,46 @@ void AAlsCharacter::RefreshViewNetworkSmoothing(const float DeltaTime)
 		NetworkSmoothing.CurrentRotation.Normalize();
 	}
 
-	NetworkSmoothing.ClientTime += DeltaTime;
-
-	const auto InterpolationAmount{
-		UAlsMath::Clamp01(1.0f - (NetworkSmoothing.ServerTime - NetworkSmoothing.ClientTime) / NetworkSmoothing.Duration)
-	};
+	auto TargetRotation{NetworkSmoothing.TargetRotation};
 
-	if (!FAnimWeight::IsFullWeight(InterpolationAmount))
+	if (bExtrapolationAllowed)
 	{
-		NetworkSmoothing.CurrentRotation = UAlsRotation::LerpRotation(NetworkSmoothing.InitialRotation, NetworkSmoothing.TargetRotation,
-		                                                              InterpolationAmount);
+		// Predict where the view is heading since the last server update. The prediction error is corrected
+		// on the next server update by interpolating from the current rotation to the new target rotation.
+
+		NetworkSmoothing.ExtrapolationTime = FMath::Min(NetworkSmoothing.ExtrapolationTime + DeltaTime,
+		                                                Settings->View.MaxNetworkExtrapolationTime);
+
+		const auto MaxAngle{Settings->View.MaxNetworkExtrapolationAngle};
+
+		TargetRotation.Pitch = FMath::ClampAngle(
+			TargetRotation.Pitch + FMath::Clamp(NetworkSmoothing.AngularVelocity.Pitch * NetworkSmoothing.ExtrapolationTime,
+			                                    -MaxAngle, MaxAngle), -90.0f, 90.0f);
+
+		TargetRotation.Yaw = FRotator::NormalizeAxis(
+			TargetRotation.Yaw + FMath::Clamp(NetworkSmoothing.AngularVelocity.Yaw * NetworkSmoothing.ExtrapolationTime,
+			                                  -MaxAngle, MaxAngle));
 	}
-	else
+
+	if (bInterpolating)
 	{
+		NetworkSmoothing.ClientTime += DeltaTime;
+
+		const auto InterpolationAmount{
+			UAlsMath::Clamp01(1.0f - (NetworkSmoothing.ServerTime - NetworkSmoothing.ClientTime) / NetworkSmoothing.Duration)
+		};
+
+		if (!FAnimWeight::IsFullWeight(InterpolationAmount))
+		{
+			NetworkSmoothing.CurrentRotation = UAlsRotation::LerpRotation(NetworkSmoothing.InitialRotation, TargetRotation,
+			                                                              InterpolationAmount);
+			return;
+		}
+
 		NetworkSmoothing.ClientTime = NetworkSmoothing.ServerTime;
-		NetworkSmoothing.CurrentRotation = NetworkSmoothing.TargetRotation;
 	}
+
+	NetworkSmoothing.CurrentRotation = TargetRotation;
 }
 
 void AAlsCharacter::SetDesiredVelocityYawAngle(const float NewVelocityYawAngle)
@@ -1493,11 +1727,15 @@ void AAlsCharacter::RefreshLocomotionLate()
 
 void AAlsCharacter::ServerSetInitialVelocityYawAngle_Implementation(const float NewVelocityYawAngle)
 {
+	ALS_COUNT_RPC(ServerSetInitialVelocityYawAngle);
+
 	MulticastSetInitialVelocityYawAngle(NewVelocityYawAngle);
 }
 
 void AAlsCharacter::MulticastSetInitialVelocityYawAngle_Implementation(const float NewVelocityYawAngle)
 {
+	ALS_COUNT_RPC(MulticastSetInitialVelocityYawAngle);
+
 	if (GetLocalRole() != ROLE_AutonomousProxy)
 	{
 		DesiredVelocityYawAngle = NewVelocityYawAngle;
@@ -1519,19 +1757,39 @@ void AAlsCharacter::OnJumped_Implementation()
 {
 	Super::OnJumped_Implementation();
 
-	if (GetLocalRole() == ROLE_AutonomousProxy)
+	if (GetLocalRole() >= ROLE_Authority)
 	{
-		OnJumpedNetworked();
+		JumpsCount += 1;
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, JumpsCount, this)
 	}
-	else if (GetLocalRole() >= ROLE_Authority)
+
+	if (GetLocalRole() >= ROLE_AutonomousProxy)
 	{
-		MulticastOnJumpedNetworked();
+		OnJumpedNetworked();
 	}
 }
 
-void AAlsCharacter::MulticastOnJumpedNetworked_Implementation()
+void AAlsCharacter::OnReplicated_JumpsCount(const uint8 PreviousJumpsCount)
 {
-	if (GetLocalRole() != ROLE_AutonomousProxy)
+	// Ignore the initial replication, since the character might have jumped long before it became relevant.
+
+	if (!HasActorBegunPlay() || JumpsCount == PreviousJumpsCount || GetLocalRole() != ROLE_SimulatedProxy)
+	{
+		return;
+	}
+
+	// Also ignore jumps that the character has already landed from. The locomotion mode can't be used here, because
+	// the movement mode received along with the jump is applied later, during the simulated tick, so check the
+	// replicated movement mode instead.
+
+	EMovementMode MovementMode;
+	uint8 CustomMovementMode;
+	EMovementMode GroundMovementMode;
+
+	UCharacterMovementComponent::UnpackNetworkMovementMode(ReplicatedMovementMode, MovementMode, CustomMovementMode, GroundMovementMode);
+
+	if (MovementMode != MOVE_Walking && MovementMode != MOVE_NavWalking)
 	{
 		OnJumpedNetworked();
 	}
@@ -1999,4 +2257,104 @@ void AAlsCharacter::RefreshViewRelativeTargetYawAngle()
 {
 	LocomotionState.ViewRelativeTargetYawAngle = FMath::UnwindDegrees(UE_REAL_TO_FLOAT(
 		ViewState.Rotation.Yaw - LocomotionState.TargetYawAngle));
-}
\ No newline at end of file
+}
+
+void AAlsCharacter::RecordRewindSnapshot(const double ServerTime)
+{
+	if (!IsValid(Settings) || ServerTime < NextRewindRecordTime)
+	{
+		return;
+	}
+
+	// Schedule the next snapshot relative to the previous scheduled time rather than to the newest snapshot time, otherwise
+	// frame time jitter at frame rates close to the record rate causes every other frame to be skipped. After a hitch,
+	// the schedule is moved to the current time so that the skipped snapshots aren't recorded all at once.
+
+	NextRewindRecordTime = FMath::Max(NextRewindRecordTime + 1.0 / Settings->Rewind.MaxRecordRate, ServerTime);
+
+	auto& Snapshot{RewindHistory.AddSnapshot()};
+
+	const auto* Capsule{GetCapsuleComponent()};
+
+	Snapshot.ServerTime = ServerTime;
+	Snapshot.Location = Capsule->GetComponentLocation();
+	Snapshot.Rotation = Capsule->GetComponentQuat();
+	Snapshot.CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+	Snapshot.CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	Snapshot.ViewRotation = ViewState.Rotation;
+	Snapshot.Stance = Stance;
+	Snapshot.LocomotionAction = LocomotionAction;
+
+	// Bone transforms are only as fresh as the last animation evaluation, so on a dedicated server the
+	// mesh must be set to always tick pose and refresh bones for them to be useful for hit validation.
+
+	Snapshot.BonesCount = FMath::Min(Settings->Rewind.BoneNames.Num(), FAlsRewindSnapshot::MaxBones);
+
+	for (auto i{0}; i < Snapshot.BonesCount; i++)
+	{
+		Snapshot.BoneTransforms[i] = GetMesh()->GetSocketTransform(Settings->Rewind.BoneNames[i]);
+	}
+}
+
+bool AAlsCharacter::TryGetRewindSnapshot(const double Time, FAlsRewindSnapshot& OutSnapshot) const
+{
+	return RewindHistory.Query(Time, OutSnapshot);
+}
+
+bool AAlsCharacter::ShouldUseReducedProxyUpdates() const
+{
+	const auto& ProxySettings{Settings->Proxy};
+
+	// Use a smaller distance when switching back to full updates to avoid switching back and forth near the threshold.
+
+	auto DistanceThreshold{ProxySettings.ReducedUpdatesDistance};
+
+	if (bReducedProxyUpdates)
+	{
+		DistanceThreshold = FMath::Max(0.0f, DistanceThreshold - ProxySettings.ReducedUpdatesDistanceHysteresis);
+	}
+
+	const auto Location{GetActorLocation()};
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* PlayerController{Iterator->Get()};
+		if (!IsValid(PlayerController) || !PlayerController->IsLocalController())
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		if (FVector::DistSquared(Location, ViewLocation) < FMath::Square(DistanceThreshold))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AAlsCharacter::RefreshReducedProxyUpdates()
+{
+	const auto bNewReducedProxyUpdates{
+		Settings->Proxy.bEnableReducedUpdates && GetLocalRole() == ROLE_SimulatedProxy && ShouldUseReducedProxyUpdates()
+	};
+
+	if (bReducedProxyUpdates == bNewReducedProxyUpdates)
+	{
+		return;
+	}
+
+	bReducedProxyUpdates = bNewReducedProxyUpdates;
+
+	if (!bReducedProxyUpdates)
+	{
+		// Restart view network smoothing from the replicated view rotation, which was used as is during
+		// the reduced updates. The rotations themselves are interpolated, so they catch up smoothly.
+
+		ViewState.NetworkSmoothing.ClientTime = ViewState.NetworkSmoothing.ServerTime;
+	}
+}
@@ -1,18 +1,27 @@
 #include "AlsCharacterMovementComponent.h"
 
 #include "AlsCharacter.h"
+#include "Animation/AnimMontage.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Curves/CurveVector.h"
 #include "Engine/World.h"
 #include "GameFramework/Controller.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Utility/AlsEnumUtility.h"
+#include "Utility/AlsLog.h"
 #include "Utility/AlsMacros.h"
+#include "Utility/AlsNetworkStats.h"
 #include "Utility/AlsRotation.h"
 #include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCharacterMovementComponent)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gait Settings Lookups"), STAT_Als_GaitSettingsLookups, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Gait Settings Resolves"), STAT_Als_GaitSettingsResolves, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Floor Sweeps Skipped"), STAT_Als_FloorSweepsSkipped, STATGROUP_Als)
+
 void FAlsCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& Move, const ENetworkMoveType MoveType)
 {
 	Super::ClientFillNetworkMoveData(Move, MoveType);
@@ -22,6 +31,7 @@ void FAlsCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Ch
 	RotationMode = SavedMove.RotationMode;
 	Stance = SavedMove.Stance;
 	MaxAllowedGait = SavedMove.MaxAllowedGait;
+	Action = SavedMove.Action;
 }
 
 bool FAlsCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Movement, FArchive& Archive,
@@ -33,9 +43,100 @@ bool FAlsCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& Moveme
 	NetSerializeOptionalValue(Archive.IsSaving(), Archive, Stance, AlsStanceTags::Standing.GetTag(), Map);
 	NetSerializeOptionalValue(Archive.IsSaving(), Archive, MaxAllowedGait, AlsGaitTags::Running.GetTag(), Map);
 
+	auto ActionType{static_cast<uint8>(Action.Type)};
+	Archive.SerializeBits(&ActionType, 2);
+
+	if (ActionType > static_cast<uint8>(EAlsNetworkActionType::Mantling))
+	{
+		Archive.SetError();
+		return false;
+	}
+
+	Action.Type = static_cast<EAlsNetworkActionType>(ActionType);
+
+	if (Action.Type == EAlsNetworkActionType::Rolling)
+	{
+		auto& Parameters{Action.RollingParameters};
+
+		UObject* Montage{Parameters.Montage};
+		Archive << Montage;
+
+		Archive << Parameters.PlayRate;
+
+		auto InitialYawAngle{FRotator::CompressAxisToShort(Parameters.InitialYawAngle)};
+		Archive << InitialYawAngle;
+
+		auto TargetYawAngle{FRotator::CompressAxisToByte(Parameters.TargetYawAngle)};
+		Archive << TargetYawAngle;
+
+		if (Archive.IsLoading())
+		{
+			Parameters.Montage = Cast<UAnimMontage>(Montage);
+			Parameters.InitialYawAngle = UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(FRotator::DecompressAxisFromShort(InitialYawAngle)));
+			Parameters.TargetYawAngle = UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(FRotator::DecompressAxisFromByte(TargetYawAngle)));
+		}
+	}
+	else if (Action.Type == EAlsNetworkActionType::Mantling)
+	{
+		auto& Parameters{Action.MantlingParameters};
+
+		UObject* TargetPrimitive{Parameters.TargetPrimitive.Get()};
+		Archive << TargetPrimitive;
+
+		bool bSuccess;
+		Parameters.TargetRelativeLocation.NetSerialize(Archive, Map, bSuccess);
+		Parameters.TargetRelativeRotation.SerializeCompressedShort(Archive);
+
+		Archive << Parameters.MantlingHeight;
+
+		auto MantlingType{static_cast<uint8>(Parameters.MantlingType)};
+		Archive.SerializeBits(&MantlingType, 2);
+
+		if (Archive.IsLoading())
+		{
+			Parameters.TargetPrimitive = Cast<UPrimitiveComponent>(TargetPrimitive);
+			Parameters.MantlingType = static_cast<EAlsMantlingType>(FMath::Min(MantlingType, static_cast<uint8>(EAlsMantlingType::InAir)));
+		}
+	}
+
 	return !Archive.IsError();
 }
 
+void FAlsCharacterNetworkMoveData::QuantizeAction(FAlsNetworkAction& Action)
+{
+	if (Action.Type == EAlsNetworkActionType::Rolling)
+	{
+		auto& Parameters{Action.RollingParameters};
+
+		Parameters.InitialYawAngle = UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(
+			FRotator::DecompressAxisFromShort(FRotator::CompressAxisToShort(Parameters.InitialYawAngle))));
+
+		Parameters.TargetYawAngle = UE_REAL_TO_FLOAT(FRotator::NormalizeAxis(
+			FRotator::DecompressAxisFromByte(FRotator::CompressAxisToByte(Parameters.TargetYawAngle))));
+	}
+	else if (Action.Type == EAlsNetworkActionType::Mantling)
+	{
+		auto& Parameters{Action.MantlingParameters};
+
+		// Matches the precision of FVector_NetQuantize100 serialization.
+
+		Parameters.TargetRelativeLocation = FVector{
+			FMath::RoundToDouble(Parameters.TargetRelativeLocation.X * 100.0),
+			FMath::RoundToDouble(Parameters.TargetRelativeLocation.Y * 100.0),
+			FMath::RoundToDouble(Parameters.TargetRelativeLocation.Z * 100.0)
+		} / 100.0;
+
+		Parameters.TargetRelativeRotation.Pitch = FRotator::DecompressAxisFromShort(
+			FRotator::CompressAxisToShort(Parameters.TargetRelativeRotation.Pitch));
+
+		Parameters.TargetRelativeRotation.Yaw = FRotator::DecompressAxisFromShort(
+			FRotator::CompressAxisToShort(Parameters.TargetRelativeRotation.Yaw));
+
+		Parameters.TargetRelativeRotation.Roll = FRotator::DecompressAxisFromShort(
+			FRotator::CompressAxisToShort(Parameters.TargetRelativeRotation.Roll));
+	}
+}
+
 FAlsCharacterNetworkMoveDataContainer::FAlsCharacterNetworkMoveDataContainer()
 {
 	NewMoveData = &MoveData[0];
@@ -50,6 +151,14 @@ void FAlsSavedMove::Clear()
 	RotationMode = AlsRotationModeTags::ViewDirection;
 	Stance = AlsStanceTags::Standing;
 	MaxAllowedGait = AlsGaitTags::Running;
+	Action = {};
+}
+
+bool FAlsSavedMove::IsImportantMove(const FSavedMovePtr& LastAckedMove) const
+{
+	// Moves that start an action are resent along with the next move if they haven't been acknowledged yet.
+
+	return Action.Type != EAlsNetworkActionType::None || Super::IsImportantMove(LastAckedMove);
 }
 
 void FAlsSavedMove::SetMoveFor(ACharacter* Character, const float NewDeltaTime, const FVector& NewAcceleration,
@@ -57,12 +166,15 @@ void FAlsSavedMove::SetMoveFor(ACharacter* Character, const float NewDeltaTime,
 {
 	Super::SetMoveFor(Character, NewDeltaTime, NewAcceleration, PredictionData);
 
-	const auto* Movement{Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement())};
+	auto* Movement{Cast<UAlsCharacterMovementComponent>(Character->GetCharacterMovement())};
 	if (IsValid(Movement))
 	{
 		RotationMode = Movement->RotationMode;
 		Stance = Movement->Stance;
 		MaxAllowedGait = Movement->MaxAllowedGait;
+
+		Action = Movement->PendingNetworkAction;
+		Movement->PendingNetworkAction = {};
 	}
 }
 
@@ -70,7 +182,9 @@ bool FAlsSavedMove::CanCombineWith(const FSavedMovePtr& NewMovePtr, ACharacter*
 {
 	const auto* NewMove{static_cast<FAlsSavedMove*>(NewMovePtr.Get())};
 
-	return RotationMode == NewMove->RotationMode &&
+	return Action.Type == EAlsNetworkActionType::None &&
+	       NewMove->Action.Type == EAlsNetworkActionType::None &&
+	       RotationMode == NewMove->RotationMode &&
 	       Stance == NewMove->Stance &&
 	       MaxAllowedGait == NewMove->MaxAllowedGait &&
 	       Super::CanCombineWith(NewMovePtr, Character, MaxDeltaTime);
@@ -199,6 +313,29 @@ void UAlsCharacterMovementComponent::BeginPlay()
 	Super::BeginPlay();
 }
 
+void UAlsCharacterMovementComponent::TickComponent(const float DeltaTime, const ELevelTick TickType,
+                                                   FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+#if WITH_EDITOR
+	if (IsValid(MovementSettings))
+	{
+		MovementSettings->RecompileGaitSettingsIfCurvesChanged();
+		RefreshGaitSettings();
+	}
+#endif
+
+	// The movement component ticks after the movement base, so this is the earliest point in
+	// the frame at which the movement base transform is final for the animation and the camera.
+
+	auto* Character{Cast<AAlsCharacter>(CharacterOwner)};
+	if (IsValid(Character))
+	{
+		Character->RefreshMovementBaseSnapshot();
+	}
+}
+
 FVector UAlsCharacterMovementComponent::ConsumeInputVector()
 {
 	auto InputVector{Super::ConsumeInputVector()};
@@ -234,6 +371,15 @@ void UAlsCharacterMovementComponent::OnMovementModeChanged(const EMovementMode P
 	// character automatically uncrouches at the end of the roll in the air.
 
 	bCrouchMaintainsBaseLocation = true;
+
+	InvalidateFloorCache();
+}
+
+void UAlsCharacterMovementComponent::OnTeleported()
+{
+	InvalidateFloorCache();
+
+	Super::OnTeleported();
 }
 
 bool UAlsCharacterMovementComponent::ShouldPerformAirControlForPathFollowing() const
@@ -627,9 +773,32 @@ void UAlsCharacterMovementComponent::PhysCustom(const float DeltaTime, int32 Ite
 	Super::PhysCustom(DeltaTime, IterationsCount);
 }
 
-void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance,
-                                                      float SweepDistance, FFindFloorResult& OutFloorResult,
-                                                      float SweepRadius, const FHitResult* DownwardSweepResult) const
+void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLocation, const float LineDistance,
+                                                      const float SweepDistance, FFindFloorResult& OutFloorResult,
+                                                      const float SweepRadius, const FHitResult* DownwardSweepResult) const
+{
+	// The supplied downward sweep already makes the floor query cheap, so the cache is only used without it.
+
+	if (DownwardSweepResult != nullptr)
+	{
+		ComputeFloorDistUncached(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, DownwardSweepResult);
+		return;
+	}
+
+	if (TryGetCachedFloor(CapsuleLocation, LineDistance, SweepDistance, SweepRadius, OutFloorResult))
+	{
+		INC_DWORD_STAT(STAT_Als_FloorSweepsSkipped);
+		return;
+	}
+
+	ComputeFloorDistUncached(CapsuleLocation, LineDistance, SweepDistance, OutFloorResult, SweepRadius, nullptr);
+
+	RefreshFloorCache(CapsuleLocation, LineDistance, SweepDistance, SweepRadius, OutFloorResult);
+}
+
+void UAlsCharacterMovementComponent::ComputeFloorDistUncached(const FVector& CapsuleLocation, float LineDistance,
+                                                              float SweepDistance, FFindFloorResult& OutFloorResult,
+                                                              float SweepRadius, const FHitResult* DownwardSweepResult) const
 {
 	// TODO Copied with modifications from UCharacterMovementComponent::ComputeFloorDist().
 	// TODO After the release of a new engine version, this code should be updated to match the source code.
@@ -792,8 +961,82 @@ void UAlsCharacterMovementComponent::ComputeFloorDist(const FVector& CapsuleLoca
 	// ReSharper restore All
 }
 
+bool UAlsCharacterMovementComponent::TryGetCachedFloor(const FVector& CapsuleLocation, const float LineDistance, const float SweepDistance,
+                                                       const float SweepRadius, FFindFloorResult& OutFloorResult) const
+{
+	if (!bAllowFloorCache || !FloorCache.bValid)
+	{
+		return false;
+	}
+
+	// Only static bases are cached, so the base can't move or change its collision response while the character stands on it.
+
+	const auto* Base{FloorCache.Base.Get()};
+
+	if (!IsValid(Base) || Base->Mobility != EComponentMobility::Static || !Base->IsQueryCollisionEnabled() ||
+	    Base->GetCollisionResponseToChannel(FloorCache.CollisionChannel) != ECR_Block)
+	{
+		return false;
+	}
+
+	float CapsuleRadius, CapsuleHalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(CapsuleRadius, CapsuleHalfHeight);
+
+	if (FloorCache.CapsuleRadius != CapsuleRadius || FloorCache.CapsuleHalfHeight != CapsuleHalfHeight ||
+	    FloorCache.LineDistance != LineDistance || FloorCache.SweepDistance != SweepDistance || FloorCache.SweepRadius != SweepRadius ||
+	    FloorCache.CollisionChannel != UpdatedComponent->GetCollisionObjectType() ||
+	    GetWorld()->GetTimeSeconds() - FloorCache.Time > FloorCacheMaxAge ||
+	    !FVector::PointsAreNear(CapsuleLocation, FloorCache.CapsuleLocation, FloorCacheLocationTolerance))
+	{
+		return false;
+	}
+
+	OutFloorResult = FloorCache.FloorResult;
+
+	// Account for the small movement within the location tolerance.
+
+	const auto FloorDistanceOffset{UE_REAL_TO_FLOAT(GetGravitySpaceZ(CapsuleLocation - FloorCache.CapsuleLocation))};
+
+	OutFloorResult.FloorDist += FloorDistanceOffset;
+
+	if (OutFloorResult.bLineTrace)
+	{
+		OutFloorResult.LineDist += FloorDistanceOffset;
+	}
+
+	return true;
+}
+
+void UAlsCharacterMovementComponent::RefreshFloorCache(const FVector& CapsuleLocation, const float LineDistance, const float SweepDistance,
+                                                       const float SweepRadius, const FFindFloorResult& FloorResult) const
+{
+	const auto* Base{FloorResult.HitResult.GetComponent()};
+
+	FloorCache.bValid = bAllowFloorCache && FloorResult.IsWalkableFloor() && !FloorResult.HitResult.bStartPenetrating &&
+	                    IsValid(Base) && Base->Mobility == EComponentMobility::Static;
+
+	if (!FloorCache.bValid)
+	{
+		return;
+	}
+
+	FloorCache.FloorResult = FloorResult;
+	FloorCache.Base = Base;
+	FloorCache.CapsuleLocation = CapsuleLocation;
+
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(FloorCache.CapsuleRadius, FloorCache.CapsuleHalfHeight);
+
+	FloorCache.LineDistance = LineDistance;
+	FloorCache.SweepDistance = SweepDistance;
+	FloorCache.SweepRadius = SweepRadius;
+	FloorCache.CollisionChannel = UpdatedComponent->GetCollisionObjectType();
+	FloorCache.Time = GetWorld()->GetTimeSeconds();
+}
+
 void UAlsCharacterMovementComponent::PerformMovement(const float DeltaTime)
 {
+	RefreshCrowdNavWalking(DeltaTime);
+
 	Super::PerformMovement(DeltaTime);
 
 	// Update the ServerLastTransformUpdateTimeStamp when the control rotation
@@ -815,6 +1058,84 @@ void UAlsCharacterMovementComponent::PerformMovement(const float DeltaTime)
 	}
 }
 
+void UAlsCharacterMovementComponent::RefreshCrowdNavWalking(const float DeltaTime)
+{
+	if (!bAllowCrowdNavWalking || !HasValidData() || CharacterOwner->GetLocalRole() < ROLE_Authority ||
+	    (MovementMode != MOVE_Walking && MovementMode != MOVE_NavWalking))
+	{
+		return;
+	}
+
+	// Root motion must be applied with full physics, so switch immediately instead of waiting for the next refresh.
+
+	const auto bHasRootMotion{HasAnimRootMotion() || CurrentRootMotion.HasActiveRootMotionSources()};
+
+	CrowdNavWalkingRefreshTimeRemaining -= DeltaTime;
+
+	if (CrowdNavWalkingRefreshTimeRemaining > 0.0f && !(bHasRootMotion && MovementMode == MOVE_NavWalking))
+	{
+		return;
+	}
+
+	CrowdNavWalkingRefreshTimeRemaining = CrowdNavWalkingRefreshInterval;
+
+	const auto NewMovementMode{!bHasRootMotion && CanUseCrowdNavWalking() ? MOVE_NavWalking : MOVE_Walking};
+
+	if (MovementMode != NewMovementMode)
+	{
+		SetMovementMode(NewMovementMode);
+	}
+}
+
+bool UAlsCharacterMovementComponent::CanUseCrowdNavWalking() const
+{
+	const auto* Controller{CharacterOwner->GetController()};
+	if (!IsValid(Controller) || Controller->IsPlayerController())
+	{
+		return false;
+	}
+
+	// The nav mesh doesn't move with movement bases, so only static floors are allowed.
+
+	if (MovementMode == MOVE_Walking)
+	{
+		const auto* Base{CurrentFloor.HitResult.GetComponent()};
+
+		if (!CurrentFloor.IsWalkableFloor() || (IsValid(Base) && Base->Mobility != EComponentMobility::Static))
+		{
+			return false;
+		}
+	}
+
+	const auto Location{UpdatedComponent->GetComponentLocation()};
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* Pawn{IsValid(Iterator->Get()) ? Iterator->Get()->GetPawn() : nullptr};
+
+		if (IsValid(Pawn) && FVector::DistSquared(Location, Pawn->GetActorLocation()) < FMath::Square(CrowdNavWalkingPlayerDistance))
+		{
+			return false;
+		}
+	}
+
+	// The nav mesh walking movement mode ignores collisions with dynamic objects, so make sure there are none nearby.
+
+	float CapsuleRadius, CapsuleHalfHeight;
+	CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(CapsuleRadius, CapsuleHalfHeight);
+
+	FCollisionObjectQueryParams ObjectQueryParameters;
+	ObjectQueryParameters.AddObjectTypesToQuery(ECC_WorldDynamic);
+	ObjectQueryParameters.AddObjectTypesToQuery(ECC_PhysicsBody);
+	ObjectQueryParameters.AddObjectTypesToQuery(ECC_Vehicle);
+	ObjectQueryParameters.AddObjectTypesToQuery(ECC_Destructible);
+
+	return !GetWorld()->OverlapAnyTestByObjectType(Location, UpdatedComponent->GetComponentQuat(), ObjectQueryParameters,
+	                                               FCollisionShape::MakeCapsule(CapsuleRadius + CrowdNavWalkingObstacleDistance,
+	                                                                            CapsuleHalfHeight + CrowdNavWalkingObstacleDistance),
+	                                               {__FUNCTION__, false, CharacterOwner});
+}
+
 FNetworkPredictionData_Client* UAlsCharacterMovementComponent::GetPredictionData_Client() const
 {
 	if (ClientPredictionData == nullptr)
@@ -854,11 +1175,29 @@ void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp,
 	const auto* MoveData{static_cast<FAlsCharacterNetworkMoveData*>(GetCurrentNetworkMoveData())};
 	if (MoveData != nullptr)
 	{
+		// Remember the first state change made by the client in this move, in case this move results in a correction.
+
+		MoveStateChange = MoveData->RotationMode != RotationMode
+			                  ? EAlsMovementCorrectionCause::RotationModeChange
+			                  : MoveData->Stance != Stance
+			                  ? EAlsMovementCorrectionCause::StanceChange
+			                  : MoveData->MaxAllowedGait != MaxAllowedGait
+			                  ? EAlsMovementCorrectionCause::MaxAllowedGaitChange
+			                  : EAlsMovementCorrectionCause::None;
+
 		RotationMode = MoveData->RotationMode;
 		Stance = MoveData->Stance;
 		MaxAllowedGait = MoveData->MaxAllowedGait;
 
 		RefreshGaitSettings();
+
+		// Start the action predicted by the client before performing the move, in the same order as the client did.
+
+		auto* Character{Cast<AAlsCharacter>(CharacterOwner)};
+		if (MoveData->Action.Type != EAlsNetworkActionType::None && IsValid(Character))
+		{
+			Character->StartNetworkAction(MoveData->Action);
+		}
 	}
 
 	Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAcceleration);
@@ -881,6 +1220,121 @@ void UAlsCharacterMovementComponent::MoveAutonomous(const float ClientTimeStamp,
 	}
 }
 
+void UAlsCharacterMovementComponent::ServerMovePacked_ClientSend(const FCharacterServerMovePackedBits& PackedBits)
+{
+	INC_DWORD_STAT(STAT_AlsNetwork_PackedMovesSent);
+	INC_DWORD_STAT_BY(STAT_AlsNetwork_PackedMoveBitsSent, PackedBits.DataBits.Num());
+
+	CSV_CUSTOM_STAT(AlsNetwork, PackedMovesSent, 1, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(AlsNetwork, PackedMoveBitsSent, PackedBits.DataBits.Num(), ECsvCustomStatOp::Accumulate);
+
+	Super::ServerMovePacked_ClientSend(PackedBits);
+}
+
+bool UAlsCharacterMovementComponent::ServerCheckClientError(const float ClientTimeStamp, const float DeltaTime, const FVector& Accel,
+                                                            const FVector& ClientWorldLocation, const FVector& RelativeClientLocation,
+                                                            UPrimitiveComponent* ClientMovementBase, const FName ClientBaseBoneName,
+                                                            const uint8 ClientMovementMode)
+{
+	const auto bHasError{
+		Super::ServerCheckClientError(ClientTimeStamp, DeltaTime, Accel, ClientWorldLocation, RelativeClientLocation,
+		                              ClientMovementBase, ClientBaseBoneName, ClientMovementMode)
+	};
+
+	if (bHasError)
+	{
+		CorrectionState.CorrectionsCount += 1;
+
+		CorrectionState.LastCorrectionCause = MoveStateChange != EAlsMovementCorrectionCause::None
+			                                      ? MoveStateChange
+			                                      : EAlsMovementCorrectionCause::LocationError;
+
+		if (MoveStateChange != EAlsMovementCorrectionCause::None)
+		{
+			CorrectionState.StateChangeCorrectionsCount += 1;
+		}
+
+		CorrectionState.LastCorrectionLocationError = UE_REAL_TO_FLOAT(
+			FVector::Dist(UpdatedComponent->GetComponentLocation(), ClientWorldLocation));
+
+		TRACE_BOOKMARK(TEXT("ALS Correction: %s (%s, %.1f cm)"), *GetNameSafe(CharacterOwner),
+		               *AlsEnumUtility::GetNameStringByValue(CorrectionState.LastCorrectionCause),
+		               CorrectionState.LastCorrectionLocationError);
+	}
+
+	MoveStateChange = EAlsMovementCorrectionCause::None;
+
+	return bHasError;
+}
+
+void UAlsCharacterMovementComponent::OnClientCorrectionReceived(FNetworkPredictionData_Client_Character& ClientData, const float TimeStamp,
+                                                                const FVector NewLocation, const FVector NewVelocity,
+                                                                UPrimitiveComponent* NewBase, const FName NewBaseBoneName,
+                                                                const bool bHasBase, const bool bBaseRelativePosition,
+                                                                const uint8 ServerMovementMode, const FVector ServerGravityDirection)
+{
+	Super::OnClientCorrectionReceived(ClientData, TimeStamp, NewLocation, NewVelocity, NewBase, NewBaseBoneName,
+	                                  bHasBase, bBaseRelativePosition, ServerMovementMode, ServerGravityDirection);
+
+	// The client doesn't know which state the server had during the corrected move, so the
+	// state change counter is only valid on the server, and here the cause is always the location error.
+
+	auto NewWorldLocation{NewLocation};
+
+	if (bBaseRelativePosition)
+	{
+		MovementBaseUtility::TransformLocationToWorld(NewBase, NewBaseBoneName, NewLocation, NewWorldLocation);
+	}
+
+	// The corrected move has already been acknowledged at this point, so its saved location is the client's location for that move.
+
+	const auto ClientWorldLocation{
+		ClientData.LastAckedMove.IsValid()
+			? ClientData.LastAckedMove->SavedLocation
+			: UpdatedComponent->GetComponentLocation()
+	};
+
+	CorrectionState.CorrectionsCount += 1;
+	CorrectionState.LastCorrectionCause = EAlsMovementCorrectionCause::LocationError;
+	CorrectionState.LastCorrectionLocationError = UE_REAL_TO_FLOAT(FVector::Dist(NewWorldLocation, ClientWorldLocation));
+}
+
+bool UAlsCharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCharacterMovementComponent::ClientUpdatePositionAfterServerUpdate"),
+	                            STAT_UAlsCharacterMovementComponent_ClientUpdatePositionAfterServerUpdate, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE(__FUNCTION__);
+
+	const auto* ClientData{HasValidData() ? GetPredictionData_Client_Character() : nullptr};
+	if (ClientData == nullptr || !ClientData->bUpdatePosition)
+	{
+		return Super::ClientUpdatePositionAfterServerUpdate();
+	}
+
+	const auto MovesCount{ClientData->SavedMoves.Num()};
+	const auto StartTime{FPlatformTime::Cycles64()};
+
+	const auto bResult{Super::ClientUpdatePositionAfterServerUpdate()};
+
+	const auto ReplayTime{static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartTime))};
+
+	CorrectionState.ReplaysCount += 1;
+	CorrectionState.LastReplayMovesCount = MovesCount;
+	CorrectionState.MaxReplayMovesCount = FMath::Max(CorrectionState.MaxReplayMovesCount, MovesCount);
+	CorrectionState.LastReplayTime = ReplayTime;
+	CorrectionState.MaxReplayTime = FMath::Max(CorrectionState.MaxReplayTime, ReplayTime);
+
+	TRACE_BOOKMARK(TEXT("ALS Move Replay: %s (%d moves, %.3f ms)"), *GetNameSafe(CharacterOwner), MovesCount, ReplayTime);
+
+	if (MoveReplayTimeBudget > 0.0f && ReplayTime > MoveReplayTimeBudget)
+	{
+		UE_LOG(LogAls, Warning, TEXT("%s: replaying %d moves took %.3f ms, which exceeds the budget of %.3f ms."),
+		       *GetNameSafe(CharacterOwner), MovesCount, ReplayTime, MoveReplayTimeBudget);
+	}
+
+	return bResult;
+}
+
 void UAlsCharacterMovementComponent::SavePenetrationAdjustment(const FHitResult& Hit)
 {
 	if (bAllowImprovedPenetrationAdjustment && Hit.bStartPenetrating)
@@ -907,6 +1361,7 @@ void UAlsCharacterMovementComponent::SetMovementSettings(UAlsMovementSettings* N
 	ALS_ENSURE(IsValid(NewMovementSettings));
 
 	MovementSettings = NewMovementSettings;
+	bGaitSettingsResolved = false;
 
 	RefreshGaitSettings();
 }
@@ -918,10 +1373,26 @@ void UAlsCharacterMovementComponent::RefreshGaitSettings()
 		return;
 	}
 
-	const auto* StanceSettings{MovementSettings->RotationModes.Find(RotationMode)};
-	const auto* NewGaitSettings{ALS_ENSURE(StanceSettings != nullptr) ? StanceSettings->Stances.Find(Stance) : nullptr};
+	INC_DWORD_STAT(STAT_Als_GaitSettingsLookups);
 
-	GaitSettings = ALS_ENSURE(NewGaitSettings != nullptr) ? *NewGaitSettings : FAlsMovementGaitSettings{};
+	// This function is called for each replayed move, but the rotation mode and stance rarely change between moves.
+
+	if (bGaitSettingsResolved && ResolvedRotationMode == RotationMode && ResolvedStance == Stance &&
+	    ResolvedGaitSettingsRevision == MovementSettings->GetCompiledGaitSettingsRevision())
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_Als_GaitSettingsResolves);
+
+	const auto* ResolvedGaitSettings{MovementSettings->FindGaitSettings(RotationMode, Stance)};
+
+	bGaitSettingsResolved = ResolvedGaitSettings != nullptr;
+	ResolvedRotationMode = RotationMode;
+	ResolvedStance = Stance;
+	ResolvedGaitSettingsRevision = MovementSettings->GetCompiledGaitSettingsRevision();
+
+	GaitSettings = ALS_ENSURE(ResolvedGaitSettings != nullptr) ? *ResolvedGaitSettings : FAlsMovementGaitSettings{};
 }
 
 void UAlsCharacterMovementComponent::SetRotationMode(const FGameplayTag& NewRotationMode)
@@ -964,7 +1435,13 @@ void UAlsCharacterMovementComponent::RefreshGroundedMovementSettings()
 		// Ideally we should use actor rotation here instead of view rotation, but we can't do that because ALS has
 		// full control over actor rotation and it is not synchronized over the network, so it would cause jitter.
 
-		const auto RelativeViewRotation{UAlsRotation::GetTwist(ViewRotation.Quaternion(), -GetGravityDirection())};
+		// Without custom gravity, the twist around the gravity direction is just the view yaw angle.
+
+		const auto RelativeViewRotation{
+			HasCustomGravity()
+				? UAlsRotation::GetTwist(ViewRotation.Quaternion(), -GetGravityDirection())
+				: FRotator{0.0f, ViewRotation.Yaw, 0.0f}.Quaternion()
+		};
 
 		const FVector2D RelativeVelocity{RelativeViewRotation.UnrotateVector(Velocity)};
 		const auto VelocityAngle{UAlsVector::DirectionToAngle(RelativeVelocity)};
@@ -1016,10 +1493,18 @@ void UAlsCharacterMovementComponent::RefreshGroundedMovementSettings()
 
 	MaxWalkSpeedCrouched = MaxWalkSpeed;
 
-	// Get acceleration, deceleration and ground friction using a curve. This
-	// allows us to precisely control the movement behavior at each speed.
+	// Get acceleration, deceleration and ground friction using a curve. This allows us to precisely control the
+	// movement behavior at each speed. Prefer the lookup table baked from the curve, since it is much cheaper.
 
-	if (ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve)))
+	FVector3f AccelerationAndDecelerationAndGroundFriction;
+
+	if (GaitSettings.TrySampleAccelerationAndDecelerationAndGroundFriction(GaitAmount, AccelerationAndDecelerationAndGroundFriction))
+	{
+		MaxAccelerationWalking = AccelerationAndDecelerationAndGroundFriction.X;
+		BrakingDecelerationWalking = AccelerationAndDecelerationAndGroundFriction.Y;
+		GroundFriction = AccelerationAndDecelerationAndGroundFriction.Z;
+	}
+	else if (ALS_ENSURE(IsValid(GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve)))
 	{
 		const auto& AccelerationAndDecelerationAndGroundFrictionCurves{
 			GaitSettings.AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves
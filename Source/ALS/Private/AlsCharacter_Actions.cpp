@@ -8,6 +8,7 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/NetConnection.h"
 #include "Engine/SkeletalMesh.h"
+#include "GameFramework/GameStateBase.h"
 #include "Net/Core/PushModel/PushModel.h"
 #include "RootMotionSources/AlsRootMotionSource_Mantling.h"
 #include "Settings/AlsCharacterSettings.h"
@@ -16,9 +17,211 @@
 #include "Utility/AlsLog.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMontageUtility.h"
+#include "Utility/AlsNetworkStats.h"
 #include "Utility/AlsRotation.h"
 #include "Utility/AlsVector.h"
 
+void AAlsCharacter::StartNetworkAction(FAlsNetworkAction Action)
+{
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		if (Action.Type == EAlsNetworkActionType::Mantling && !IsLocallyControlled() &&
+		    !ValidateMantlingParameters(Action.MantlingParameters))
+		{
+			return;
+		}
+
+		if (StartNetworkActionImplementation(Action))
+		{
+			SetNetworkAction(Action, true);
+		}
+	}
+	else if (GetLocalRole() == ROLE_AutonomousProxy && Action.Type != EAlsNetworkActionType::Ragdolling)
+	{
+		FAlsCharacterNetworkMoveData::QuantizeAction(Action);
+
+		if (StartNetworkActionImplementation(Action))
+		{
+			AlsCharacterMovement->SetPendingNetworkAction(Action);
+		}
+	}
+}
+
+bool AAlsCharacter::StartNetworkActionImplementation(const FAlsNetworkAction& Action)
+{
+	switch (Action.Type)
+	{
+		case EAlsNetworkActionType::Rolling:
+			return StartRollingImplementation(Action.RollingParameters);
+
+		case EAlsNetworkActionType::Mantling:
+			return StartMantlingImplementation(Action.MantlingParameters);
+
+		case EAlsNetworkActionType::Ragdolling:
+			return StartRagdollingImplementation();
+
+		default:
+			return false;
+	}
+}
+
+void AAlsCharacter::SetNetworkAction(const FAlsNetworkAction& NewAction, const bool bSendEvent)
+{
+	if (NewAction.Type != EAlsNetworkActionType::None)
+	{
+		NetworkAction.Id = NetworkAction.Id < MAX_uint8 ? NetworkAction.Id + 1 : 1;
+	}
+
+	// The time is updated on every state change, including stopping the action, so that the stop event of
+	// a long action, such as ragdolling, isn't considered stale just because the action was started long ago.
+
+	const auto* GameState{GetWorld()->GetGameState()};
+	NetworkAction.ServerTime = IsValid(GameState)
+		                           ? UE_REAL_TO_FLOAT(GameState->GetServerWorldTimeSeconds())
+		                           : UE_REAL_TO_FLOAT(GetWorld()->GetTimeSeconds());
+
+	NetworkAction.Action = NewAction;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, NetworkAction, this)
+
+	if (bSendEvent && !IsNetMode(NM_Standalone))
+	{
+		bSendingNetworkActionEvent = true;
+		MulticastNetworkActionEvent(NetworkAction);
+		bSendingNetworkActionEvent = false;
+
+		ForceNetUpdate();
+	}
+}
+
+void AAlsCharacter::MulticastNetworkActionEvent_Implementation(const FAlsNetworkActionState& State)
+{
+	ALS_COUNT_RPC(MulticastNetworkActionEvent);
+
+	if (GetLocalRole() >= ROLE_Authority)
+	{
+		return;
+	}
+
+	// Drop events that arrived too late. In this case, the action will be started from the replicated state.
+
+	if (CalculateNetworkActionAge(State) <= Settings->NetworkActions.MaxEventAge)
+	{
+		ApplyNetworkAction(State);
+	}
+}
+
+void AAlsCharacter::OnReplicated_NetworkAction(const FAlsNetworkActionState& PreviousNetworkAction)
+{
+	ApplyNetworkAction(NetworkAction);
+}
+
+void AAlsCharacter::ApplyNetworkAction(const FAlsNetworkActionState& State)
+{
+	// Ignore actions older than the last applied one. This may happen if the replicated state arrives before the action event. Until
+	// the first action has been applied, for example after joining late or becoming relevant again, there is nothing to compare
+	// against, so the first received action is treated as the newest one.
+
+	const auto IdDelta{bNetworkActionApplied ? static_cast<int8>(State.Id - AppliedNetworkActionId) : 1};
+	if (IdDelta < 0)
+	{
+		return;
+	}
+
+	// Ragdolling is never predicted, so it is stopped on all clients once the server has stopped it.
+
+	if (LocomotionAction == AlsLocomotionActionTags::Ragdolling && State.Action.Type != EAlsNetworkActionType::Ragdolling)
+	{
+		StopRagdollingImplementation();
+	}
+
+	if (IdDelta == 0)
+	{
+		return;
+	}
+
+	AppliedNetworkActionId = State.Id;
+	bNetworkActionApplied = true;
+
+	if (GetLocalRole() == ROLE_AutonomousProxy && State.Action.Type != EAlsNetworkActionType::Ragdolling)
+	{
+		return;
+	}
+
+	if (StartNetworkActionImplementation(State.Action))
+	{
+		FastForwardNetworkAction(State.Action, CalculateNetworkActionAge(State));
+	}
+}
+
+float AAlsCharacter::CalculateNetworkActionAge(const FAlsNetworkActionState& State) const
+{
+	const auto* GameState{GetWorld()->GetGameState()};
+
+	return IsValid(GameState)
+		       ? FMath::Max(0.0f, UE_REAL_TO_FLOAT(GameState->GetServerWorldTimeSeconds()) - State.ServerTime)
+		       : 0.0f;
+}
+
+void AAlsCharacter::FastForwardNetworkAction(const FAlsNetworkAction& Action, const float Time)
+{
+	if (Time <= 0.0f)
+	{
+		return;
+	}
+
+	auto* AnimInstance{GetMesh()->GetAnimInstance()};
+
+	if (Action.Type == EAlsNetworkActionType::Rolling)
+	{
+		const auto* Montage{Action.RollingParameters.Montage.Get()};
+
+		AnimInstance->Montage_SetPosition(Montage, FMath::Min(AnimInstance->Montage_GetPosition(Montage) +
+		                                                      Time * Action.RollingParameters.PlayRate, Montage->GetPlayLength()));
+	}
+	else if (Action.Type == EAlsNetworkActionType::Mantling)
+	{
+		auto* RootMotionSource{
+			StaticCastSharedPtr<FAlsRootMotionSource_Mantling>(GetCharacterMovement()
+				->GetRootMotionSourceByID(static_cast<uint16>(MantlingState.RootMotionSourceId))).Get()
+		};
+
+		if (RootMotionSource == nullptr)
+		{
+			return;
+		}
+
+		RootMotionSource->SetTime(FMath::Min(RootMotionSource->GetTime() + Time, RootMotionSource->GetDuration()));
+
+		const auto* Montage{IsValid(RootMotionSource->MantlingSettings) ? RootMotionSource->MantlingSettings->Montage.Get() : nullptr};
+		if (!IsValid(Montage))
+		{
+			return;
+		}
+
+		AnimInstance->Montage_SetPosition(Montage, FMath::Min(AnimInstance->Montage_GetPosition(Montage) +
+		                                                      Time * Montage->RateScale, Montage->GetPlayLength()));
+	}
+}
+
+void AAlsCharacter::RefreshNetworkActionOnLocomotionActionChanged()
+{
+	if (GetLocalRole() < ROLE_Authority || NetworkAction.Action.Type == EAlsNetworkActionType::None)
+	{
+		return;
+	}
+
+	// Reset the replicated action once it ends, so that late joiners don't start it again. Clients
+	// must stop ragdolling at the same time as the server, so in that case an action event is sent.
+
+	if ((NetworkAction.Action.Type == EAlsNetworkActionType::Rolling && LocomotionAction != AlsLocomotionActionTags::Rolling) ||
+	    (NetworkAction.Action.Type == EAlsNetworkActionType::Mantling && LocomotionAction != AlsLocomotionActionTags::Mantling) ||
+	    (NetworkAction.Action.Type == EAlsNetworkActionType::Ragdolling && LocomotionAction != AlsLocomotionActionTags::Ragdolling))
+	{
+		SetNetworkAction({}, NetworkAction.Action.Type == EAlsNetworkActionType::Ragdolling);
+	}
+}
+
 void AAlsCharacter::StartRolling(const float PlayRate)
 {
 	if (LocomotionMode == AlsLocomotionModeTags::Grounded)
@@ -50,19 +253,14 @@ void AAlsCharacter::StartRolling(const float PlayRate, const float TargetYawAngl
 		return;
 	}
 
-	const auto InitialYawAngle{UE_REAL_TO_FLOAT(FMath::UnwindDegrees(GetActorRotation().Yaw))};
+	FAlsNetworkAction Action;
+	Action.Type = EAlsNetworkActionType::Rolling;
+	Action.RollingParameters.Montage = Montage;
+	Action.RollingParameters.PlayRate = PlayRate;
+	Action.RollingParameters.InitialYawAngle = UE_REAL_TO_FLOAT(FMath::UnwindDegrees(GetActorRotation().Yaw));
+	Action.RollingParameters.TargetYawAngle = TargetYawAngle;
 
-	if (GetLocalRole() >= ROLE_Authority)
-	{
-		MulticastStartRolling(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
-	}
-	else
-	{
-		GetCharacterMovement()->FlushServerMoves();
-
-		StartRollingImplementation(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
-		ServerStartRolling(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
-	}
+	StartNetworkAction(Action);
 }
 
 UAnimMontage* AAlsCharacter::SelectRollMontage_Implementation()
@@ -70,33 +268,21 @@ UAnimMontage* AAlsCharacter::SelectRollMontage_Implementation()
 	return Settings->Rolling.Montage;
 }
 
-void AAlsCharacter::ServerStartRolling_Implementation(UAnimMontage* Montage, const float PlayRate,
-                                                      const float InitialYawAngle, const float TargetYawAngle)
+bool AAlsCharacter::StartRollingImplementation(const FAlsRollingParameters& Parameters)
 {
-	if (IsRollingAllowedToStart(Montage))
+	if (!IsValid(Parameters.Montage) || !IsRollingAllowedToStart(Parameters.Montage) ||
+	    GetMesh()->GetAnimInstance()->Montage_Play(Parameters.Montage, Parameters.PlayRate) <= 0.0f)
 	{
-		MulticastStartRolling(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
-		ForceNetUpdate();
+		return false;
 	}
-}
 
-void AAlsCharacter::MulticastStartRolling_Implementation(UAnimMontage* Montage, const float PlayRate,
-                                                         const float InitialYawAngle, const float TargetYawAngle)
-{
-	StartRollingImplementation(Montage, PlayRate, InitialYawAngle, TargetYawAngle);
-}
+	RollingState.TargetYawAngle = Parameters.TargetYawAngle;
 
-void AAlsCharacter::StartRollingImplementation(UAnimMontage* Montage, const float PlayRate,
-                                               const float InitialYawAngle, const float TargetYawAngle)
-{
-	if (IsRollingAllowedToStart(Montage) && GetMesh()->GetAnimInstance()->Montage_Play(Montage, PlayRate) > 0.0f)
-	{
-		RollingState.TargetYawAngle = TargetYawAngle;
+	SetRotationInstant(Parameters.InitialYawAngle);
 
-		SetRotationInstant(InitialYawAngle);
+	SetLocomotionAction(AlsLocomotionActionTags::Rolling);
 
-		SetLocomotionAction(AlsLocomotionActionTags::Rolling);
-	}
+	return true;
 }
 
 void AAlsCharacter::RefreshRolling(const float DeltaTime)
@@ -161,6 +347,21 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 		return false;
 	}
 
+	FAlsNetworkAction Action;
+	Action.Type = EAlsNetworkActionType::Mantling;
+
+	if (!TraceMantling(TraceSettings, Action.MantlingParameters))
+	{
+		return false;
+	}
+
+	StartNetworkAction(Action);
+
+	return true;
+}
+
+bool AAlsCharacter::TraceMantling(const FAlsMantlingTraceSettings& TraceSettings, FAlsMantlingParameters& OutParameters)
+{
 	const auto ActorLocation{GetActorLocation()};
 	const auto ActorYawAngle{UE_REAL_TO_FLOAT(FMath::UnwindDegrees(GetActorRotation().Yaw))};
 
@@ -391,18 +592,16 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 
 	const auto TargetRotation{TargetDirection.ToOrientationQuat()};
 
-	FAlsMantlingParameters Parameters;
-
-	Parameters.TargetPrimitive = TargetPrimitive;
-	Parameters.MantlingHeight = UE_REAL_TO_FLOAT((TargetLocation.Z - CapsuleBottomLocation.Z) / CapsuleScale);
+	OutParameters.TargetPrimitive = TargetPrimitive;
+	OutParameters.MantlingHeight = UE_REAL_TO_FLOAT((TargetLocation.Z - CapsuleBottomLocation.Z) / CapsuleScale);
 
 	// Determine the mantling type by checking the movement mode and mantling height.
 
-	Parameters.MantlingType = LocomotionMode != AlsLocomotionModeTags::Grounded
-		                          ? EAlsMantlingType::InAir
-		                          : Parameters.MantlingHeight > Settings->Mantling.MantlingHighHeightThreshold
-		                          ? EAlsMantlingType::High
-		                          : EAlsMantlingType::Low;
+	OutParameters.MantlingType = LocomotionMode != AlsLocomotionModeTags::Grounded
+		                             ? EAlsMantlingType::InAir
+		                             : OutParameters.MantlingHeight > Settings->Mantling.MantlingHighHeightThreshold
+		                             ? EAlsMantlingType::High
+		                             : EAlsMantlingType::Low;
 
 	// If the target primitive can't move, then use world coordinates to save
 	// some performance by skipping some coordinate space transformations later.
@@ -413,56 +612,134 @@ bool AAlsCharacter::StartMantling(const FAlsMantlingTraceSettings& TraceSettings
 			TargetPrimitive->GetComponentTransform().GetRelativeTransform({TargetRotation, TargetLocation})
 		};
 
-		Parameters.TargetRelativeLocation = TargetRelativeTransform.GetLocation();
-		Parameters.TargetRelativeRotation = TargetRelativeTransform.Rotator();
+		OutParameters.TargetRelativeLocation = TargetRelativeTransform.GetLocation();
+		OutParameters.TargetRelativeRotation = TargetRelativeTransform.Rotator();
 	}
 	else
 	{
-		Parameters.TargetRelativeLocation = TargetLocation;
-		Parameters.TargetRelativeRotation = TargetRotation.Rotator();
+		OutParameters.TargetRelativeLocation = TargetLocation;
+		OutParameters.TargetRelativeRotation = TargetRotation.Rotator();
 	}
 
-	if (GetLocalRole() >= ROLE_Authority)
+	return true;
+}
+
+bool AAlsCharacter::ValidateMantlingParameters(const FAlsMantlingParameters& Parameters)
+{
+	if (!Settings->Mantling.bValidateClientMantling)
 	{
-		MulticastStartMantling(Parameters);
+		return true;
 	}
-	else
+
+	ALS_COUNT_NETWORK_STAT(MantlingValidations);
+
+	// Reject parameters that the client could not have obtained from its own traces at all. These
+	// checks are purely analytical and compare the parameters against the mantling trace settings.
+
+	auto* TargetPrimitive{Parameters.TargetPrimitive.Get()};
+
+	const auto& TraceSettings{
+		Parameters.MantlingType == EAlsMantlingType::InAir
+			? Settings->Mantling.InAirTrace
+			: Settings->Mantling.GroundedTrace
+	};
+
+	const auto Tolerance{Settings->Mantling.ValidationTolerance};
+
+	if (!IsValid(TargetPrimitive) || !TargetPrimitive->CanCharacterStepUp(this) ||
+	    Parameters.MantlingHeight < TraceSettings.LedgeHeight.GetMin() - Tolerance ||
+	    Parameters.MantlingHeight > TraceSettings.LedgeHeight.GetMax() + Tolerance)
 	{
-		GetCharacterMovement()->FlushServerMoves();
+		ALS_COUNT_NETWORK_STAT(MantlingRejections);
+		return false;
+	}
 
-		StartMantlingImplementation(Parameters);
-		ServerStartMantling(Parameters);
+	const auto* Capsule{GetCapsuleComponent()};
+
+	const auto CapsuleScale{Capsule->GetComponentScale().Z};
+	const auto CapsuleRadius{Capsule->GetScaledCapsuleRadius()};
+
+	const auto TargetLocation{
+		MovementBaseUtility::UseRelativeLocation(TargetPrimitive)
+			? FTransform{
+				Parameters.TargetRelativeRotation.GetNormalized(), Parameters.TargetRelativeLocation,
+				TargetPrimitive->GetComponentScale()
+			}.GetRelativeTransformReverse(TargetPrimitive->GetComponentTransform()).GetLocation()
+			: FVector{Parameters.TargetRelativeLocation}
+	};
+
+	const auto ActorFeetLocation{GetCharacterMovement()->GetActorFeetLocation()};
+
+	const auto MaxReachDistance{
+		CapsuleRadius + (TraceSettings.ReachDistance + TraceSettings.TargetLocationOffset + 1.0f) * CapsuleScale + Tolerance
+	};
+
+	if ((TargetLocation - ActorFeetLocation).SizeSquared2D() > FMath::Square(MaxReachDistance))
+	{
+		ALS_COUNT_NETWORK_STAT(MantlingRejections);
+		return false;
 	}
 
-	return true;
-}
+	// Check that the mantling height matches the server's character location, and that the target location lies on the
+	// target primitive. Instead of a scene query, a single overlap against only the target primitive is used for this.
 
-void AAlsCharacter::ServerStartMantling_Implementation(const FAlsMantlingParameters& Parameters)
-{
-	if (IsMantlingAllowedToStart(Parameters))
+	const auto bSuspicious{
+		FMath::Abs((TargetLocation.Z - ActorFeetLocation.Z) / CapsuleScale - Parameters.MantlingHeight) > Tolerance ||
+		TargetPrimitive->GetComponentVelocity().SizeSquared() > FMath::Square(Settings->Mantling.TargetPrimitiveSpeedThreshold) ||
+		!TargetPrimitive->Bounds.GetBox().ExpandBy(Tolerance).IsInsideOrOn(TargetLocation) ||
+		!TargetPrimitive->OverlapComponent(TargetLocation, FQuat::Identity, FCollisionShape::MakeSphere(Tolerance))
+	};
+
+	if (!bSuspicious)
 	{
-		MulticastStartMantling(Parameters);
-		ForceNetUpdate();
+		return true;
 	}
-}
 
-void AAlsCharacter::MulticastStartMantling_Implementation(const FAlsMantlingParameters& Parameters)
-{
-	StartMantlingImplementation(Parameters);
+	// Fall back to the full mantling traces, but only while the trace budget allows it,
+	// so that a single client can't significantly increase the server's query load.
+
+	const auto WorldTime{GetWorld()->GetTimeSeconds()};
+	const auto MaxTraces{Settings->Mantling.MaxValidationTracesPerSecond};
+
+	MantlingState.ValidationTraceBudget = FMath::Min(
+		MantlingState.ValidationTraceBudget + UE_REAL_TO_FLOAT(WorldTime - MantlingState.ValidationTraceBudgetTime) * MaxTraces,
+		MaxTraces);
+
+	MantlingState.ValidationTraceBudgetTime = WorldTime;
+
+	if (MantlingState.ValidationTraceBudget < 1.0f)
+	{
+		ALS_COUNT_NETWORK_STAT(MantlingRejections);
+		return false;
+	}
+
+	MantlingState.ValidationTraceBudget -= 1.0f;
+
+	ALS_COUNT_NETWORK_STAT(MantlingValidationTraces);
+
+	FAlsMantlingParameters ServerParameters;
+
+	if (!TraceMantling(TraceSettings, ServerParameters) || ServerParameters.TargetPrimitive != Parameters.TargetPrimitive)
+	{
+		ALS_COUNT_NETWORK_STAT(MantlingRejections);
+		return false;
+	}
+
+	return true;
 }
 
-void AAlsCharacter::StartMantlingImplementation(const FAlsMantlingParameters& Parameters)
+bool AAlsCharacter::StartMantlingImplementation(const FAlsMantlingParameters& Parameters)
 {
 	if (!IsMantlingAllowedToStart(Parameters))
 	{
-		return;
+		return false;
 	}
 
 	const auto* MantlingSettings{SelectMantlingSettings(Parameters.MantlingType)};
 
 	if (!ALS_ENSURE(IsValid(MantlingSettings)) || !ALS_ENSURE(IsValid(MantlingSettings->Montage)))
 	{
-		return;
+		return false;
 	}
 
 	const auto StartTime{CalculateMantlingStartTime(MantlingSettings, Parameters.MantlingHeight)};
@@ -475,7 +752,7 @@ void AAlsCharacter::StartMantlingImplementation(const FAlsMantlingParameters& Pa
 	{
 		UE_LOG(LogAls, Warning, TEXT("Can't start mantling! The %s animation montage has incorrect root motion,")
 		       TEXT(" the final vertical location of the character must be non-zero!"), *MantlingSettings->Montage->GetName());
-		return;
+		return false;
 	}
 
 	// Calculate actor offsets (offsets between actor and target transform).
@@ -517,6 +794,7 @@ void AAlsCharacter::StartMantlingImplementation(const FAlsMantlingParameters& Pa
 	RootMotionSource->InstanceName = __FUNCTION__;
 	RootMotionSource->Duration = Duration / PlayRate;
 	RootMotionSource->MantlingSettings = MantlingSettings;
+	RootMotionSource->MantlingSettingsIndex = GetOrAddMantlingSettingsIndex(MantlingSettings);
 	RootMotionSource->TargetPrimitive = Parameters.TargetPrimitive;
 	RootMotionSource->TargetRelativeLocation = Parameters.TargetRelativeLocation;
 	RootMotionSource->TargetRelativeRotation = TargetRelativeRotation;
@@ -535,6 +813,8 @@ void AAlsCharacter::StartMantlingImplementation(const FAlsMantlingParameters& Pa
 	}
 
 	OnMantlingStarted(Parameters);
+
+	return true;
 }
 
 UAlsMantlingSettings* AAlsCharacter::SelectMantlingSettings_Implementation(EAlsMantlingType MantlingType)
@@ -542,6 +822,31 @@ UAlsMantlingSettings* AAlsCharacter::SelectMantlingSettings_Implementation(EAlsM
 	return nullptr;
 }
 
+uint8 AAlsCharacter::GetOrAddMantlingSettingsIndex(const UAlsMantlingSettings* MantlingSettings)
+{
+	auto Index{MantlingSettingsTable.Find(MantlingSettings)};
+
+	// Only the server is allowed to add new entries. On clients, the index remains invalid until the
+	// table is replicated, in which case the root motion source falls back to the full serialization.
+
+	if (Index == INDEX_NONE && GetLocalRole() >= ROLE_Authority &&
+	    MantlingSettingsTable.Num() < FAlsRootMotionSource_Mantling::InvalidMantlingSettingsIndex)
+	{
+		Index = MantlingSettingsTable.Add(MantlingSettings);
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, MantlingSettingsTable, this)
+	}
+
+	return Index != INDEX_NONE
+		       ? static_cast<uint8>(Index)
+		       : FAlsRootMotionSource_Mantling::InvalidMantlingSettingsIndex;
+}
+
+const UAlsMantlingSettings* AAlsCharacter::GetMantlingSettingsByIndex(const uint8 Index) const
+{
+	return MantlingSettingsTable.IsValidIndex(Index) ? MantlingSettingsTable[Index].Get() : nullptr;
+}
+
 // ReSharper disable once CppMemberFunctionMayBeStatic
 float AAlsCharacter::CalculateMantlingStartTime(const UAlsMantlingSettings* MantlingSettings, const float MantlingHeight) const
 {
@@ -660,7 +965,7 @@ void AAlsCharacter::StopMantling(const bool bStopMontage)
 
 	MantlingState.RootMotionSourceId = 0;
 
-	if (bStopMontage && RootMotionSource != nullptr)
+	if (bStopMontage && RootMotionSource != nullptr && IsValid(RootMotionSource->MantlingSettings))
 	{
 		GetMesh()->GetAnimInstance()->Montage_Stop(Settings->Mantling.BlendOutDuration, RootMotionSource->MantlingSettings->Montage);
 	}
@@ -695,7 +1000,10 @@ void AAlsCharacter::StartRagdolling()
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
-		MulticastStartRagdolling();
+		FAlsNetworkAction Action;
+		Action.Type = EAlsNetworkActionType::Ragdolling;
+
+		StartNetworkAction(Action);
 	}
 	else
 	{
@@ -707,23 +1015,22 @@ void AAlsCharacter::StartRagdolling()
 
 void AAlsCharacter::ServerStartRagdolling_Implementation()
 {
+	ALS_COUNT_RPC(ServerStartRagdolling);
+
 	if (IsRagdollingAllowedToStart())
 	{
-		MulticastStartRagdolling();
-		ForceNetUpdate();
-	}
-}
+		FAlsNetworkAction Action;
+		Action.Type = EAlsNetworkActionType::Ragdolling;
 
-void AAlsCharacter::MulticastStartRagdolling_Implementation()
-{
-	StartRagdollingImplementation();
+		StartNetworkAction(Action);
+	}
 }
 
-void AAlsCharacter::StartRagdollingImplementation()
+bool AAlsCharacter::StartRagdollingImplementation()
 {
 	if (!IsRagdollingAllowedToStart())
 	{
-		return;
+		return false;
 	}
 
 	GetMesh()->bUpdateJointsFromAnimation = true; // Required for the flail animation to work properly.
@@ -800,6 +1107,8 @@ void AAlsCharacter::StartRagdollingImplementation()
 	SetLocomotionAction(AlsLocomotionActionTags::Ragdolling);
 
 	OnRagdollingStarted();
+
+	return true;
 }
 
 void AAlsCharacter::OnRagdollingStarted_Implementation() {}
@@ -821,6 +1130,8 @@ void AAlsCharacter::SetRagdollTargetLocation(const FVector& NewTargetLocation)
 
 void AAlsCharacter::ServerSetRagdollTargetLocation_Implementation(const FVector_NetQuantize& NewTargetLocation)
 {
+	ALS_COUNT_RPC(ServerSetRagdollTargetLocation);
+
 	SetRagdollTargetLocation(NewTargetLocation);
 }
 
@@ -996,7 +1307,9 @@ bool AAlsCharacter::StopRagdolling()
 
 	if (GetLocalRole() >= ROLE_Authority)
 	{
-		MulticastStopRagdolling();
+		// Clients will stop ragdolling after receiving the action event or the replicated network action state.
+
+		StopRagdollingImplementation();
 	}
 	else
 	{
@@ -1008,18 +1321,14 @@ bool AAlsCharacter::StopRagdolling()
 
 void AAlsCharacter::ServerStopRagdolling_Implementation()
 {
+	ALS_COUNT_RPC(ServerStopRagdolling);
+
 	if (IsRagdollingAllowedToStop())
 	{
-		MulticastStopRagdolling();
-		ForceNetUpdate();
+		StopRagdollingImplementation();
 	}
 }
 
-void AAlsCharacter::MulticastStopRagdolling_Implementation()
-{
-	StopRagdollingImplementation();
-}
-
 void AAlsCharacter::StopRagdollingImplementation()
 {
 	if (!IsRagdollingAllowedToStop())
@@ -1,5 +1,7 @@
 #include "AlsCharacter.h"
 
+#include "AlsCharacterMovementComponent.h"
+#include "AlsNetUpdateFrequencyComponent.h"
 #include "DisplayDebugHelpers.h"
 #include "DrawDebugHelpers.h"
 #include "Animation/AnimInstance.h"
@@ -11,6 +13,7 @@
 #include "Engine/SkeletalMesh.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Utility/AlsConstants.h"
+#include "Utility/AlsEnumUtility.h"
 #include "Utility/AlsMath.h"
 #include "Utility/AlsUtility.h"
 #include "Utility/AlsVector.h"
@@ -38,7 +41,8 @@ void AAlsCharacter::DisplayDebug(UCanvas* Canvas, const FDebugDisplayInfo& Displ
 	    !DisplayInfo.IsDisplayOn(UAlsConstants::StateDebugDisplayName()) &&
 	    !DisplayInfo.IsDisplayOn(UAlsConstants::ShapesDebugDisplayName()) &&
 	    !DisplayInfo.IsDisplayOn(UAlsConstants::TracesDebugDisplayName()) &&
-	    !DisplayInfo.IsDisplayOn(UAlsConstants::MantlingDebugDisplayName()))
+	    !DisplayInfo.IsDisplayOn(UAlsConstants::MantlingDebugDisplayName()) &&
+	    !DisplayInfo.IsDisplayOn(UAlsConstants::CorrectionsDebugDisplayName()))
 	{
 		VerticalLocation = MaxVerticalLocation;
 
@@ -128,6 +132,21 @@ void AAlsCharacter::DisplayDebug(UCanvas* Canvas, const FDebugDisplayInfo& Displ
 	VerticalLocation += RowOffset;
 	MaxVerticalLocation = FMath::Max(MaxVerticalLocation, VerticalLocation);
 
+	static const auto CorrectionsHeaderText{FText::AsCultureInvariant(FString{TEXTVIEW("Als.Corrections (Shift + 9)")})};
+
+	if (DisplayInfo.IsDisplayOn(UAlsConstants::CorrectionsDebugDisplayName()))
+	{
+		DisplayDebugHeader(Canvas, CorrectionsHeaderText, FLinearColor::Green, Scale, HorizontalLocation, VerticalLocation);
+		DisplayDebugCorrections(Canvas, Scale, HorizontalLocation, VerticalLocation);
+	}
+	else
+	{
+		DisplayDebugHeader(Canvas, CorrectionsHeaderText, {0.0f, 0.333333f, 0.0f}, Scale, HorizontalLocation, VerticalLocation);
+	}
+
+	VerticalLocation += RowOffset;
+	MaxVerticalLocation = FMath::Max(MaxVerticalLocation, VerticalLocation);
+
 	VerticalLocation = MaxVerticalLocation;
 
 	Super::DisplayDebug(Canvas, DisplayInfo, Unused, VerticalLocation);
@@ -360,6 +379,30 @@ void AAlsCharacter::DisplayDebugState(const UCanvas* Canvas, const float Scale,
 	Text.Draw(Canvas->Canvas, {HorizontalLocation + ColumnOffset, VerticalLocation});
 
 	VerticalLocation += RowOffset;
+
+	// Net update frequency is only meaningful on the server.
+
+	if (GetLocalRole() >= ROLE_Authority && !IsNetMode(NM_Standalone))
+	{
+		static const auto NetUpdateFrequencyText{FText::AsCultureInvariant(FString{TEXTVIEW("Net Update Frequency")})};
+
+		Text.Text = NetUpdateFrequencyText;
+		Text.Draw(Canvas->Canvas, {HorizontalLocation, VerticalLocation});
+
+		TStringBuilder<64> NetUpdateFrequencyBuilder;
+		NetUpdateFrequencyBuilder.Appendf(TEXT("%.0f (Min %.0f) Hz"), GetNetUpdateFrequency(), GetMinNetUpdateFrequency());
+
+		const auto* NetUpdateFrequencyComponent{FindComponentByClass<UAlsNetUpdateFrequencyComponent>()};
+		if (IsValid(NetUpdateFrequencyComponent))
+		{
+			NetUpdateFrequencyBuilder << TEXTVIEW(" ") << AlsEnumUtility::GetNameStringByValue(NetUpdateFrequencyComponent->GetActivity());
+		}
+
+		Text.Text = FText::AsCultureInvariant(FString{NetUpdateFrequencyBuilder});
+		Text.Draw(Canvas->Canvas, {HorizontalLocation + ColumnOffset, VerticalLocation});
+
+		VerticalLocation += RowOffset;
+	}
 }
 
 void AAlsCharacter::DisplayDebugShapes(const UCanvas* Canvas, const float Scale,
@@ -640,4 +683,61 @@ void AAlsCharacter::DisplayDebugMantling(const UCanvas* Canvas, const float Scal
 	VerticalLocation += RowOffset;
 }
 
+void AAlsCharacter::DisplayDebugCorrections(const UCanvas* Canvas, const float Scale,
+                                            const float HorizontalLocation, float& VerticalLocation) const
+{
+	VerticalLocation += 4.0f * Scale;
+
+	FCanvasTextItem Text{
+		FVector2D::ZeroVector,
+		FText::GetEmpty(),
+		GEngine->GetMediumFont(),
+		FLinearColor::White
+	};
+
+	Text.Scale = {Scale * 0.75f, Scale * 0.75f};
+	Text.EnableShadow(FLinearColor::Black);
+
+	const auto RowOffset{12.0f * Scale};
+	const auto ColumnOffset{150.0f * Scale};
+
+	const auto& CorrectionState{AlsCharacterMovement->GetCorrectionState()};
+
+	const auto DrawRow{
+		[&](const FText& Label, const FString& Value)
+		{
+			Text.Text = Label;
+			Text.Draw(Canvas->Canvas, {HorizontalLocation, VerticalLocation});
+
+			Text.Text = FText::AsCultureInvariant(Value);
+			Text.Draw(Canvas->Canvas, {HorizontalLocation + ColumnOffset, VerticalLocation});
+
+			VerticalLocation += RowOffset;
+		}
+	};
+
+	static const auto CorrectionsCountText{LOCTEXT("CorrectionsCount", "Corrections Count")};
+	static const auto StateChangeCorrectionsCountText{LOCTEXT("StateChangeCorrectionsCount", "Server State Changes")};
+	static const auto LastCorrectionCauseText{LOCTEXT("LastCorrectionCause", "Last Correction Cause")};
+	static const auto LastCorrectionLocationErrorText{LOCTEXT("LastCorrectionLocationError", "Last Correction Error")};
+
+	DrawRow(CorrectionsCountText, FString::FromInt(CorrectionState.CorrectionsCount));
+	DrawRow(StateChangeCorrectionsCountText, FString::FromInt(CorrectionState.StateChangeCorrectionsCount));
+	DrawRow(LastCorrectionCauseText, FName::NameToDisplayString(
+		        AlsEnumUtility::GetNameStringByValue(CorrectionState.LastCorrectionCause), false));
+	DrawRow(LastCorrectionLocationErrorText, FString::Printf(TEXT("%.2f cm"), CorrectionState.LastCorrectionLocationError));
+
+	static const auto ReplaysCountText{LOCTEXT("ReplaysCount", "Replays Count")};
+	static const auto LastReplayMovesCountText{LOCTEXT("LastReplayMovesCount", "Last Replay Moves")};
+	static const auto MaxReplayMovesCountText{LOCTEXT("MaxReplayMovesCount", "Max Replay Moves")};
+	static const auto LastReplayTimeText{LOCTEXT("LastReplayTime", "Last Replay Time")};
+	static const auto MaxReplayTimeText{LOCTEXT("MaxReplayTime", "Max Replay Time")};
+
+	DrawRow(ReplaysCountText, FString::FromInt(CorrectionState.ReplaysCount));
+	DrawRow(LastReplayMovesCountText, FString::FromInt(CorrectionState.LastReplayMovesCount));
+	DrawRow(MaxReplayMovesCountText, FString::FromInt(CorrectionState.MaxReplayMovesCount));
+	DrawRow(LastReplayTimeText, FString::Printf(TEXT("%.3f ms"), CorrectionState.LastReplayTime));
+	DrawRow(MaxReplayTimeText, FString::Printf(TEXT("%.3f ms"), CorrectionState.MaxReplayTime));
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -4,6 +4,7 @@
 #include "Net/Core/PushModel/PushModel.h"
 #include "Settings/AlsCharacterSettings.h"
 #include "Utility/AlsConstants.h"
+#include "Utility/AlsNetworkStats.h"
 
 void AAlsCharacter::SetFlightMode(const FGameplayTag& NewFlightMode)
 {
@@ -54,6 +55,8 @@ void AAlsCharacter::OnFlightModeChanged_Implementation(const FGameplayTag& Previ
 
 void AAlsCharacter::ServerSetFlightMode_Implementation(const FGameplayTag& NewFlightMode)
 {
+	ALS_COUNT_RPC(ServerSetFlightMode);
+
 	SetFlightMode(NewFlightMode);
 }
 
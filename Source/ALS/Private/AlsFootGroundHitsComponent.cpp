@@ -0,0 +1,62 @@
+#include "AlsFootGroundHitsComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsFootGroundHitsComponent)
+
+UAlsFootGroundHitsComponent::UAlsFootGroundHitsComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UAlsFootGroundHitsComponent::SetFootGroundHit(const FName& FootBoneName, const FHitResult& Hit, const ECollisionChannel TraceChannel)
+{
+	FScopeLock Lock{&FootGroundHitsLock};
+
+	auto* GroundHit{
+		FootGroundHits.FindByPredicate([&FootBoneName](const FAlsFootGroundHitState& FootGroundHit)
+		{
+			return FootGroundHit.FootBoneName == FootBoneName;
+		})
+	};
+
+	if (GroundHit == nullptr)
+	{
+		GroundHit = &FootGroundHits.AddDefaulted_GetRef();
+		GroundHit->FootBoneName = FootBoneName;
+	}
+
+	GroundHit->Hit = Hit;
+	GroundHit->TraceChannel = TraceChannel;
+	GroundHit->FrameNumber = GFrameCounter;
+}
+
+bool UAlsFootGroundHitsComponent::TryGetRecentFootGroundHit(const FName& FootBoneName, const ECollisionChannel TraceChannel,
+                                                            FHitResult& OutHit) const
+{
+	FScopeLock Lock{&FootGroundHitsLock};
+
+	const auto* GroundHit{
+		FootGroundHits.FindByPredicate([&FootBoneName](const FAlsFootGroundHitState& FootGroundHit)
+		{
+			return FootGroundHit.FootBoneName == FootBoneName;
+		})
+	};
+
+	// Animation notifies are dispatched after the animation evaluation of the same frame, but
+	// also accept the previous frame's hit in case the evaluation was skipped this frame.
+
+	if (GroundHit == nullptr || GFrameCounter - GroundHit->FrameNumber > 1)
+	{
+		return false;
+	}
+
+	// A miss or a hit on a different channel may not match what the caller would have found
+	// with its own trace, so let the caller trace by itself in these cases.
+
+	if (!GroundHit->Hit.bBlockingHit || GroundHit->TraceChannel != TraceChannel)
+	{
+		return false;
+	}
+
+	OutHit = GroundHit->Hit;
+	return true;
+}
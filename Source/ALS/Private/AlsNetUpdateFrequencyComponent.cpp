@@ -0,0 +1,152 @@
+#include "AlsNetUpdateFrequencyComponent.h"
+
+#include "AlsCharacter.h"
+#include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsNetUpdateFrequencyComponent)
+
+UAlsNetUpdateFrequencyComponent::UAlsNetUpdateFrequencyComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	bTickInEditor = false;
+}
+
+void UAlsNetUpdateFrequencyComponent::OnRegister()
+{
+	Character = Cast<AAlsCharacter>(GetOwner());
+
+	Super::OnRegister();
+}
+
+void UAlsNetUpdateFrequencyComponent::RegisterComponentTickFunctions(const bool bRegister)
+{
+	Super::RegisterComponentTickFunctions(bRegister);
+
+	// Tick after the owner to have access to the most up-to-date character state.
+
+	AddTickPrerequisiteActor(GetOwner());
+}
+
+void UAlsNetUpdateFrequencyComponent::BeginPlay()
+{
+	ALS_ENSURE(IsValid(Settings));
+	ALS_ENSURE(IsValid(Character));
+
+	Super::BeginPlay();
+
+	// Net update frequency only matters on the server.
+
+	if (IsValid(Settings) && IsValid(Character) && GetOwnerRole() >= ROLE_Authority && !IsNetMode(NM_Standalone))
+	{
+		SetActivity(CalculateActivity());
+		SetComponentTickEnabled(true);
+	}
+}
+
+void UAlsNetUpdateFrequencyComponent::TickComponent(const float DeltaTime, const ELevelTick TickType,
+                                                    FActorComponentTickFunction* ThisTickFunction)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsNetUpdateFrequencyComponent::TickComponent"),
+	                            STAT_UAlsNetUpdateFrequencyComponent_TickComponent, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE(__FUNCTION__);
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (!IsValid(Settings) || !IsValid(Character))
+	{
+		return;
+	}
+
+	const auto NewActivity{CalculateActivity()};
+
+	const auto NewFrequency{Settings->GetRate(NewActivity).NetUpdateFrequency};
+	const auto Frequency{Settings->GetRate(Activity).NetUpdateFrequency};
+
+	if (NewFrequency >= Frequency)
+	{
+		DemotionTimeRemaining = Settings->DemotionDelay;
+
+		if (NewFrequency > Frequency)
+		{
+			// Promote immediately and don't wait for the next update, since the start
+			// of the new activity is usually the most important part to replicate.
+
+			SetActivity(NewActivity);
+			GetOwner()->ForceNetUpdate();
+		}
+		else if (NewActivity != Activity)
+		{
+			// The activities may still have different minimum frequencies, so apply both of them.
+
+			SetActivity(NewActivity);
+		}
+	}
+	else
+	{
+		DemotionTimeRemaining -= DeltaTime;
+
+		if (DemotionTimeRemaining <= 0.0f)
+		{
+			DemotionTimeRemaining = Settings->DemotionDelay;
+
+			SetActivity(NewActivity);
+		}
+	}
+}
+
+EAlsNetUpdateActivity UAlsNetUpdateFrequencyComponent::CalculateActivity() const
+{
+	const auto& LocomotionAction{Character->GetLocomotionAction()};
+
+	if (LocomotionAction == AlsLocomotionActionTags::Ragdolling)
+	{
+		return EAlsNetUpdateActivity::Ragdolling;
+	}
+
+	// Multiple activities can be active at the same time, for example, turning while moving,
+	// so pick the one with the highest net update frequency among the active ones.
+
+	auto NewActivity{EAlsNetUpdateActivity::Idle};
+
+	const auto TryActivity{
+		[this, &NewActivity](const EAlsNetUpdateActivity Candidate)
+		{
+			if (Settings->GetRate(Candidate).NetUpdateFrequency > Settings->GetRate(NewActivity).NetUpdateFrequency)
+			{
+				NewActivity = Candidate;
+			}
+		}
+	};
+
+	if (LocomotionAction.IsValid())
+	{
+		TryActivity(EAlsNetUpdateActivity::Action);
+	}
+
+	if (Character->GetLocomotionState().bMoving)
+	{
+		TryActivity(Character->GetGait() == AlsGaitTags::Sprinting
+			            ? EAlsNetUpdateActivity::Sprinting
+			            : EAlsNetUpdateActivity::Moving);
+	}
+
+	if (Character->GetViewState().YawSpeed > Settings->ViewYawSpeedThreshold)
+	{
+		TryActivity(EAlsNetUpdateActivity::Turning);
+	}
+
+	return NewActivity;
+}
+
+void UAlsNetUpdateFrequencyComponent::SetActivity(const EAlsNetUpdateActivity NewActivity)
+{
+	Activity = NewActivity;
+
+	const auto& Rate{Settings->GetRate(Activity)};
+
+	GetOwner()->SetNetUpdateFrequency(Rate.NetUpdateFrequency);
+	GetOwner()->SetMinNetUpdateFrequency(FMath::Min(Rate.MinNetUpdateFrequency, Rate.NetUpdateFrequency));
+}
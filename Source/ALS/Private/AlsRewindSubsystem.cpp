@@ -0,0 +1,89 @@
+#include "AlsRewindSubsystem.h"
+
+#include "AlsCharacter.h"
+#include "Engine/World.h"
+#include "Utility/AlsUtility.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRewindSubsystem)
+
+bool UAlsRewindSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAlsRewindSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	WorldPostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::OnWorldPostActorTick);
+}
+
+void UAlsRewindSubsystem::Deinitialize()
+{
+	FWorldDelegates::OnWorldPostActorTick.Remove(WorldPostActorTickHandle);
+	WorldPostActorTickHandle.Reset();
+
+	Characters.Reset();
+
+	Super::Deinitialize();
+}
+
+void UAlsRewindSubsystem::RegisterCharacter(AAlsCharacter* Character)
+{
+	if (IsValid(Character))
+	{
+		Characters.AddUnique(Character);
+	}
+}
+
+void UAlsRewindSubsystem::RewindCharacters(const double Time, TArray<TPair<AAlsCharacter*, FAlsRewindSnapshot>>& OutSnapshots) const
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsRewindSubsystem::RewindCharacters"),
+	                            STAT_UAlsRewindSubsystem_RewindCharacters, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE(__FUNCTION__);
+
+	OutSnapshots.Reset(Characters.Num());
+
+	for (const auto& WeakCharacter : Characters)
+	{
+		auto* Character{WeakCharacter.Get()};
+		if (!IsValid(Character))
+		{
+			continue;
+		}
+
+		auto& Snapshot{OutSnapshots.Emplace_GetRef(Character, FAlsRewindSnapshot{}).Value};
+
+		if (!Character->TryGetRewindSnapshot(Time, Snapshot))
+		{
+			OutSnapshots.Pop(EAllowShrinking::No);
+		}
+	}
+}
+
+void UAlsRewindSubsystem::OnWorldPostActorTick(UWorld* World, const ELevelTick TickType, const float DeltaTime)
+{
+	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsRewindSubsystem::OnWorldPostActorTick"),
+	                            STAT_UAlsRewindSubsystem_OnWorldPostActorTick, STATGROUP_Als)
+	TRACE_CPUPROFILER_EVENT_SCOPE(__FUNCTION__);
+
+	if (World != GetWorld() || World->IsNetMode(NM_Client) || TickType == LEVELTICK_ViewportsOnly)
+	{
+		return;
+	}
+
+	const auto ServerTime{World->GetTimeSeconds()};
+
+	for (auto i{Characters.Num() - 1}; i >= 0; i--)
+	{
+		auto* Character{Characters[i].Get()};
+		if (IsValid(Character))
+		{
+			Character->RecordRewindSnapshot(ServerTime);
+		}
+		else
+		{
+			Characters.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		}
+	}
+}
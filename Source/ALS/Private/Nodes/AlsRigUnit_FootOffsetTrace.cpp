@@ -1,5 +1,6 @@
 #include "Nodes/AlsRigUnit_FootOffsetTrace.h"
 
+#include "AlsFootGroundHitsComponent.h"
 #include "Engine/HitResult.h"
 #include "Engine/World.h"
 
@@ -21,9 +22,30 @@ FAlsRigUnit_FootOffsetTrace_Execute()
 	const FVector TraceStart{FootTargetLocation.X, FootTargetLocation.Y, TraceDistanceUpward};
 	const FVector TraceEnd{FootTargetLocation.X, FootTargetLocation.Y, -TraceDistanceDownward};
 
+	FCollisionQueryParams QueryParameters{__FUNCTION__, true, ExecuteContext.GetOwningActor()};
+	QueryParameters.bReturnPhysicalMaterial = bShareGroundHit;
+
 	FHitResult Hit;
 	ExecuteContext.GetWorld()->LineTraceSingleByChannel(Hit, ExecuteContext.ToWorldSpace(TraceStart), ExecuteContext.ToWorldSpace(TraceEnd),
-	                                                    TraceChannel, {__FUNCTION__, true, ExecuteContext.GetOwningActor()});
+	                                                    TraceChannel, QueryParameters);
+
+	if (bShareGroundHit)
+	{
+		const auto* OwningActor{ExecuteContext.GetOwningActor()};
+
+		// The component stores ground hits under a lock, so this is safe during parallel animation evaluation.
+
+		auto* FootGroundHits{OwningActor != nullptr ? OwningActor->FindComponentByClass<UAlsFootGroundHitsComponent>() : nullptr};
+
+		if (FootBoneName.IsNone())
+		{
+			UE_CONTROLRIG_RIGUNIT_REPORT_WARNING(TEXT("The foot bone name must be set to share the ground hit."));
+		}
+		else if (FootGroundHits != nullptr)
+		{
+			FootGroundHits->SetFootGroundHit(FootBoneName, Hit, TraceChannel);
+		}
+	}
 
 	auto* DrawInterface{ExecuteContext.GetDrawInterface()};
 	if (DrawInterface != nullptr && bDrawDebug)
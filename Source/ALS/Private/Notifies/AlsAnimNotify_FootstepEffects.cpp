@@ -1,12 +1,14 @@
 #include "Notifies/AlsAnimNotify_FootstepEffects.h"
 
 #include "AlsCharacter.h"
+#include "AlsFootGroundHitsComponent.h"
 #include "DrawDebugHelpers.h"
 #include "NiagaraFunctionLibrary.h"
 #include "Animation/AnimInstance.h"
 #include "Components/AudioComponent.h"
 #include "Components/DecalComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/AssetManager.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
@@ -16,9 +18,13 @@
 #include "Utility/AlsEnumUtility.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMath.h"
+#include "Utility/AlsUtility.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsAnimNotify_FootstepEffects)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Footstep Effects Not Loaded"), STAT_Als_FootstepEffectsNotLoaded, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Footstep Traces Saved"), STAT_Als_FootstepTracesSaved, STATGROUP_Als)
+
 #if WITH_EDITOR
 void FAlsFootstepDecalSettings::PostEditChangeProperty(const FPropertyChangedEvent& ChangedEvent)
 {
@@ -52,10 +58,125 @@ void UAlsFootstepEffectsSettings::PostEditChangeProperty(FPropertyChangedEvent&
 		}
 	}
 
+	// Always recompile the effects, since the changed property may be unknown, for example after a reimport.
+
+	CompileEffects();
+
+	// The effects are preloaded again when a footstep is played in a world.
+
+	ReleasePreloadedEffects();
+
 	Super::PostEditChangeProperty(ChangedEvent);
 }
+
+void UAlsFootstepEffectsSettings::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	CompileEffects();
+
+	ReleasePreloadedEffects();
+}
 #endif
 
+void UAlsFootstepEffectsSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	CompileEffects();
+}
+
+void UAlsFootstepEffectsSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileEffects();
+
+	// In the editor, the settings are also loaded by the asset editors and the cook, where the effects are never played,
+	// so the effects are preloaded there only when a footstep is played in a world.
+
+	if (!HasAnyFlags(RF_ClassDefaultObject) && !GIsEditor)
+	{
+		PreloadEffects();
+	}
+}
+
+void UAlsFootstepEffectsSettings::BeginDestroy()
+{
+	ReleasePreloadedEffects();
+
+	Super::BeginDestroy();
+}
+
+void UAlsFootstepEffectsSettings::CompileEffects()
+{
+	CompiledEffects.Reset(Effects.Num());
+
+	// If there are no settings for a surface type, then the first settings are used as a fallback.
+
+	CompiledEffectIndices.Init(Effects.IsEmpty() ? INDEX_NONE : 0, SurfaceType_Max);
+
+	for (const auto& Tuple : Effects)
+	{
+		const auto EffectIndex{CompiledEffects.Add(Tuple.Value)};
+
+		if (CompiledEffectIndices.IsValidIndex(Tuple.Key))
+		{
+			CompiledEffectIndices[Tuple.Key] = EffectIndex;
+		}
+	}
+}
+
+const FAlsFootstepEffectSettings* UAlsFootstepEffectsSettings::FindEffectSettings(const EPhysicalSurface SurfaceType) const
+{
+	const auto EffectIndex{CompiledEffectIndices.IsValidIndex(SurfaceType) ? CompiledEffectIndices[SurfaceType] : INDEX_NONE};
+
+	return CompiledEffects.IsValidIndex(EffectIndex) ? &CompiledEffects[EffectIndex] : nullptr;
+}
+
+void UAlsFootstepEffectsSettings::PreloadEffects()
+{
+	// Footstep effects are never spawned on a dedicated server, so there is no need to load them there.
+
+	if (bPreloadRequested || IsRunningDedicatedServer() || IsRunningCommandlet() || !UAssetManager::IsInitialized())
+	{
+		return;
+	}
+
+	bPreloadRequested = true;
+
+	TArray<FSoftObjectPath> AssetPaths;
+	AssetPaths.Reserve(Effects.Num() * 3);
+
+	for (const auto& Tuple : Effects)
+	{
+		AssetPaths.AddUnique(Tuple.Value.Sound.Sound.ToSoftObjectPath());
+		AssetPaths.AddUnique(Tuple.Value.Decal.DecalMaterial.ToSoftObjectPath());
+		AssetPaths.AddUnique(Tuple.Value.ParticleSystem.ParticleSystem.ToSoftObjectPath());
+	}
+
+	AssetPaths.RemoveAllSwap([](const FSoftObjectPath& AssetPath)
+	{
+		return AssetPath.IsNull();
+	});
+
+	if (!AssetPaths.IsEmpty())
+	{
+		PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths));
+	}
+}
+
+void UAlsFootstepEffectsSettings::ReleasePreloadedEffects()
+{
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->ReleaseHandle();
+		PreloadHandle.Reset();
+	}
+
+	bPreloadRequested = false;
+}
+
 FString UAlsAnimNotify_FootstepEffects::GetNotifyName_Implementation() const
 {
 	TStringBuilder<64> NotifyNameBuilder{InPlace, TEXTVIEW("Als Footstep Effects: "), AlsEnumUtility::GetNameStringByValue(FootBone)};
@@ -82,6 +203,16 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 		return;
 	}
 
+	const auto* World{Mesh->GetWorld()};
+
+	// Usually the effects are already preloaded when the settings are loaded, but the asset manager may not have been
+	// initialized then, and in the editor they are preloaded only once they are needed by a game or preview world.
+
+	if (IsValid(World) && (World->IsGameWorld() || World->WorldType == EWorldType::EditorPreview))
+	{
+		FootstepEffectsSettings->PreloadEffects();
+	}
+
 	const auto* Character{Cast<AAlsCharacter>(Mesh->GetOwner())};
 
 	if (bSkipEffectsWhenInAir && IsValid(Character) && Character->IsInAir())
@@ -93,7 +224,6 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	const auto bDisplayDebug{UAlsDebugUtility::ShouldDisplayDebugForActor(Mesh->GetOwner(), UAlsConstants::TracesDebugDisplayName())};
 #endif
 
-	const auto* World{Mesh->GetWorld()};
 	const auto MeshScale{Mesh->GetComponentScale().Z};
 
 	const auto& FootBoneName{FootBone == EAlsFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
@@ -108,11 +238,20 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	FCollisionQueryParams QueryParameters{__FUNCTION__, true, Mesh->GetOwner()};
 	QueryParameters.bReturnPhysicalMaterial = true;
 
+	// Reuse the ground hit shared by the foot offset trace rig unit, if it is recent enough.
+
+	const auto* FootGroundHits{IsValid(Mesh->GetOwner()) ? Mesh->GetOwner()->FindComponentByClass<UAlsFootGroundHitsComponent>() : nullptr};
+
 	FHitResult FootstepHit;
-	if (!World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
-	                                     FootTransform.GetLocation() - FootZAxis *
-	                                     (FootstepEffectsSettings->SurfaceTraceDistance * MeshScale),
-	                                     FootstepEffectsSettings->SurfaceTraceChannel, QueryParameters))
+	if (IsValid(FootGroundHits) &&
+	    FootGroundHits->TryGetRecentFootGroundHit(FootBoneName, FootstepEffectsSettings->SurfaceTraceChannel, FootstepHit))
+	{
+		INC_DWORD_STAT(STAT_Als_FootstepTracesSaved);
+	}
+	else if (!World->LineTraceSingleByChannel(FootstepHit, FootTransform.GetLocation(),
+	                                          FootTransform.GetLocation() - FootZAxis *
+	                                          (FootstepEffectsSettings->SurfaceTraceDistance * MeshScale),
+	                                          FootstepEffectsSettings->SurfaceTraceChannel, QueryParameters))
 	{
 		// As a fallback, trace down the world Z axis if the first trace didn't hit anything.
 
@@ -136,20 +275,11 @@ void UAlsAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAnimS
 	}
 
 	const auto SurfaceType{FootstepHit.PhysMaterial.IsValid() ? FootstepHit.PhysMaterial->SurfaceType.GetValue() : SurfaceType_Default};
-	const auto* EffectSettings{FootstepEffectsSettings->Effects.Find(SurfaceType)};
+	const auto* EffectSettings{FootstepEffectsSettings->FindEffectSettings(SurfaceType)};
 
 	if (EffectSettings == nullptr)
 	{
-		for (const auto& Tuple : FootstepEffectsSettings->Effects)
-		{
-			EffectSettings = &Tuple.Value;
-			break;
-		}
-
-		if (EffectSettings == nullptr)
-		{
-			return;
-		}
+		return;
 	}
 
 	const auto FootstepLocation{FootstepHit.ImpactPoint};
@@ -195,11 +325,19 @@ void UAlsAnimNotify_FootstepEffects::SpawnSound(USkeletalMeshComponent* Mesh, co
 		VolumeMultiplier *= 1.0f - UAlsMath::Clamp01(Mesh->GetAnimInstance()->GetCurveValue(UAlsConstants::FootstepSoundBlockCurveName()));
 	}
 
-	if (!FAnimWeight::IsRelevant(VolumeMultiplier) || !IsValid(SoundSettings.Sound.LoadSynchronous()))
+	if (!FAnimWeight::IsRelevant(VolumeMultiplier) || SoundSettings.Sound.IsNull())
 	{
 		return;
 	}
 
+	// Skip the effect instead of loading it synchronously if it hasn't been preloaded yet.
+
+	if (!IsValid(SoundSettings.Sound.Get()))
+	{
+		INC_DWORD_STAT(STAT_Als_FootstepEffectsNotLoaded);
+		return;
+	}
+
 	UAudioComponent* Audio{nullptr};
 
 	if (SoundSettings.SpawnMode == EAlsFootstepSoundSpawnMode::SpawnAtTraceHitLocation)
@@ -244,11 +382,17 @@ void UAlsAnimNotify_FootstepEffects::SpawnDecal(USkeletalMeshComponent* Mesh, co
 		return;
 	}
 
-	if (!IsValid(DecalSettings.DecalMaterial.LoadSynchronous()))
+	if (DecalSettings.DecalMaterial.IsNull())
 	{
 		return;
 	}
 
+	if (!IsValid(DecalSettings.DecalMaterial.Get()))
+	{
+		INC_DWORD_STAT(STAT_Als_FootstepEffectsNotLoaded);
+		return;
+	}
+
 	const auto DecalRotation{
 		FootstepRotation * FQuat{
 			FootBone == EAlsFootBone::Left
@@ -289,8 +433,14 @@ void UAlsAnimNotify_FootstepEffects::SpawnParticleSystem(USkeletalMeshComponent*
                                                          const FAlsFootstepParticleSystemSettings& ParticleSystemSettings,
                                                          const FVector& FootstepLocation, const FQuat& FootstepRotation) const
 {
-	if (!IsValid(ParticleSystemSettings.ParticleSystem.LoadSynchronous()))
+	if (ParticleSystemSettings.ParticleSystem.IsNull())
+	{
+		return;
+	}
+
+	if (!IsValid(ParticleSystemSettings.ParticleSystem.Get()))
 	{
+		INC_DWORD_STAT(STAT_Als_FootstepEffectsNotLoaded);
 		return;
 	}
 
@@ -1,5 +1,6 @@
 ﻿#include "RootMotionSources/AlsRootMotionSource_Mantling.h"
 
+#include "AlsCharacter.h"
 #include "Animation/AnimInstance.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Curves/CurveFloat.h"
@@ -31,7 +32,21 @@ bool FAlsRootMotionSource_Mantling::Matches(const FRootMotionSource* Other) cons
 
 	const auto* OtherCasted{static_cast<const FAlsRootMotionSource_Mantling*>(Other)};
 
-	return MantlingSettings == OtherCasted->MantlingSettings &&
+	// With compact network serialization, one of the root motion sources may not have resolved its mantling
+	// settings or may not know their index yet, so compare only what is known on both sides.
+
+	const auto bMantlingSettingsIndexMatches{
+		MantlingSettingsIndex == OtherCasted->MantlingSettingsIndex ||
+		MantlingSettingsIndex == InvalidMantlingSettingsIndex ||
+		OtherCasted->MantlingSettingsIndex == InvalidMantlingSettingsIndex
+	};
+
+	const auto bMantlingSettingsMatches{
+		MantlingSettings == OtherCasted->MantlingSettings ||
+		!IsValid(MantlingSettings) || !IsValid(OtherCasted->MantlingSettings)
+	};
+
+	return bMantlingSettingsIndexMatches && bMantlingSettingsMatches &&
 	       TargetPrimitive == OtherCasted->TargetPrimitive;
 }
 
@@ -40,7 +55,8 @@ void FAlsRootMotionSource_Mantling::PrepareRootMotion(const float SimulationDelt
 {
 	SetTime(GetTime() + SimulationDeltaTime);
 
-	if (!ALS_ENSURE(GetDuration() > UE_SMALL_NUMBER) || DeltaTime <= UE_SMALL_NUMBER || !TargetPrimitive.IsValid())
+	if (!ALS_ENSURE(GetDuration() > UE_SMALL_NUMBER) || DeltaTime <= UE_SMALL_NUMBER ||
+	    !TargetPrimitive.IsValid() || !TryResolveMantlingSettings(Character))
 	{
 		RootMotionParams.Clear();
 		return;
@@ -152,7 +168,31 @@ bool FAlsRootMotionSource_Mantling::NetSerialize(FArchive& Archive, UPackageMap*
 	bSuccess = true;
 	auto bSuccessLocal{true};
 
-	Archive << MantlingSettings;
+	// In compact mode, the mantling settings are sent as an index into the character's mantling settings table,
+	// and the target animation location is not sent at all, since it can be derived from the mantling settings.
+
+	uint8 bCompact{MantlingSettingsIndex != InvalidMantlingSettingsIndex};
+	Archive.SerializeBits(&bCompact, 1);
+
+	if (bCompact)
+	{
+		Archive << MantlingSettingsIndex;
+
+		if (Archive.IsLoading())
+		{
+			MantlingSettings = nullptr;
+		}
+	}
+	else
+	{
+		Archive << MantlingSettings;
+
+		if (Archive.IsLoading())
+		{
+			MantlingSettingsIndex = InvalidMantlingSettingsIndex;
+		}
+	}
+
 	Archive << TargetPrimitive;
 
 	bSuccess &= SerializePackedVector<100, 30>(TargetRelativeLocation, Archive);
@@ -161,13 +201,21 @@ bool FAlsRootMotionSource_Mantling::NetSerialize(FArchive& Archive, UPackageMap*
 	TargetRelativeRotation.Normalize();
 	bSuccess &= bSuccessLocal;
 
-	bSuccess &= SerializePackedVector<100, 30>(ActorFeetLocationOffset, Archive);
+	// The actor feet location offset is relative to the target transform and is usually small, so in compact mode it is
+	// sent with a lower precision, which is still more than enough since it is blended out over the mantling duration.
+
+	bSuccess &= bCompact
+		            ? SerializePackedVector<10, 24>(ActorFeetLocationOffset, Archive)
+		            : SerializePackedVector<100, 30>(ActorFeetLocationOffset, Archive);
 
 	ActorRotationOffset.NetSerialize(Archive, Map, bSuccessLocal);
 	ActorRotationOffset.Normalize();
 	bSuccess &= bSuccessLocal;
 
-	bSuccess &= SerializePackedVector<100, 30>(TargetAnimationLocation, Archive);
+	if (!bCompact)
+	{
+		bSuccess &= SerializePackedVector<100, 30>(TargetAnimationLocation, Archive);
+	}
 
 	Archive << MontageStartTime;
 
@@ -194,3 +242,27 @@ void FAlsRootMotionSource_Mantling::AddReferencedObjects(FReferenceCollector& Co
 
 	Collector.AddReferencedObject(MantlingSettings);
 }
+
+bool FAlsRootMotionSource_Mantling::TryResolveMantlingSettings(const ACharacter& Character)
+{
+	if (IsValid(MantlingSettings))
+	{
+		return true;
+	}
+
+	const auto* AlsCharacter{Cast<AAlsCharacter>(&Character)};
+	if (!IsValid(AlsCharacter))
+	{
+		return false;
+	}
+
+	MantlingSettings = AlsCharacter->GetMantlingSettingsByIndex(MantlingSettingsIndex);
+	if (!IsValid(MantlingSettings) || !IsValid(MantlingSettings->Montage))
+	{
+		MantlingSettings = nullptr;
+		return false;
+	}
+
+	TargetAnimationLocation = UAlsMontageUtility::ExtractLastRootTransformFromMontage(MantlingSettings->Montage).GetLocation();
+	return true;
+}
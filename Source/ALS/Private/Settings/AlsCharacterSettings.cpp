@@ -1,5 +1,7 @@
 ﻿#include "Settings/AlsCharacterSettings.h"
 
+#include "Utility/AlsConstants.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCharacterSettings)
 
 UAlsCharacterSettings::UAlsCharacterSettings()
@@ -14,6 +16,13 @@ UAlsCharacterSettings::UAlsCharacterSettings()
 	Mantling.MantlingTraceResponses.WorldStatic = ECR_Block;
 	Mantling.MantlingTraceResponses.WorldDynamic = ECR_Block;
 	Mantling.MantlingTraceResponses.Destructible = ECR_Block;
+
+	Rewind.BoneNames =
+	{
+		UAlsConstants::HeadBoneName(),
+		UAlsConstants::Spine03BoneName(),
+		UAlsConstants::PelvisBoneName()
+	};
 }
 
 #if WITH_EDITOR
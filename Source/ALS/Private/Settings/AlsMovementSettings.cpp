@@ -1,7 +1,141 @@
 #include "Settings/AlsMovementSettings.h"
 
+#include "Curves/CurveVector.h"
+#include "Utility/AlsLog.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsMovementSettings)
 
+#if WITH_EDITOR
+namespace AlsMovementSettings
+{
+	uint32 CalculateCurveHash(const UCurveVector& Curve)
+	{
+		auto Hash{0u};
+
+		for (const auto& FloatCurve : Curve.FloatCurves)
+		{
+			Hash = HashCombineFast(Hash, GetTypeHash(FloatCurve.DefaultValue));
+			Hash = HashCombineFast(Hash, GetTypeHash(FloatCurve.PreInfinityExtrap.GetValue()));
+			Hash = HashCombineFast(Hash, GetTypeHash(FloatCurve.PostInfinityExtrap.GetValue()));
+
+			for (const auto& Key : FloatCurve.Keys)
+			{
+				Hash = HashCombineFast(Hash, GetTypeHash(Key.Time));
+				Hash = HashCombineFast(Hash, GetTypeHash(Key.Value));
+				Hash = HashCombineFast(Hash, GetTypeHash(Key.ArriveTangent));
+				Hash = HashCombineFast(Hash, GetTypeHash(Key.LeaveTangent));
+				Hash = HashCombineFast(Hash, GetTypeHash(Key.ArriveTangentWeight));
+				Hash = HashCombineFast(Hash, GetTypeHash(Key.LeaveTangentWeight));
+				Hash = HashCombineFast(Hash, GetTypeHash(Key.InterpMode.GetValue()));
+				Hash = HashCombineFast(Hash, GetTypeHash(Key.TangentMode.GetValue()));
+				Hash = HashCombineFast(Hash, GetTypeHash(Key.TangentWeightMode.GetValue()));
+			}
+		}
+
+		return Hash;
+	}
+}
+#endif
+
+void FAlsMovementGaitSettings::BakeAccelerationAndDecelerationAndGroundFrictionTable(const int32 Resolution)
+{
+	auto& Table{AccelerationAndDecelerationAndGroundFrictionTable};
+
+	Table.Reset();
+	AccelerationAndDecelerationAndGroundFrictionTableMaxError = FVector3f::ZeroVector;
+
+#if WITH_EDITORONLY_DATA
+	AccelerationAndDecelerationAndGroundFrictionTableCurveHash = 0;
+#endif
+
+	if (!IsValid(AccelerationAndDecelerationAndGroundFrictionCurve))
+	{
+		return;
+	}
+
+	// The curve may not be post loaded yet when the table is baked from the post load of the movement settings.
+
+	AccelerationAndDecelerationAndGroundFrictionCurve->ConditionalPostLoad();
+
+#if WITH_EDITORONLY_DATA
+	AccelerationAndDecelerationAndGroundFrictionTableCurveHash =
+		AlsMovementSettings::CalculateCurveHash(*AccelerationAndDecelerationAndGroundFrictionCurve);
+#endif
+
+	if (Resolution < 2)
+	{
+		return;
+	}
+
+	const auto& Curves{AccelerationAndDecelerationAndGroundFrictionCurve->FloatCurves};
+
+	const auto EvaluateCurves{
+		[&Curves](const float GaitAmount)
+		{
+			return FVector3f{Curves[0].Eval(GaitAmount), Curves[1].Eval(GaitAmount), Curves[2].Eval(GaitAmount)};
+		}
+	};
+
+	// Gait amount ranges from 0 to 3.
+
+	const auto SampleInterval{3.0f / static_cast<float>(Resolution - 1)};
+
+	Table.Reserve(Resolution);
+
+	for (auto i{0}; i < Resolution; i++)
+	{
+		Table.Add(EvaluateCurves(static_cast<float>(i) * SampleInterval));
+	}
+
+	// Measure the lookup table error by comparing it against the curve between the samples.
+
+	static constexpr auto ErrorSamplesPerInterval{8};
+
+	auto& MaxError{AccelerationAndDecelerationAndGroundFrictionTableMaxError};
+
+	for (auto i{0}; i < (Resolution - 1) * ErrorSamplesPerInterval; i++)
+	{
+		const auto GaitAmount{static_cast<float>(i) * SampleInterval / ErrorSamplesPerInterval};
+
+		FVector3f TableValues;
+		TrySampleAccelerationAndDecelerationAndGroundFriction(GaitAmount, TableValues);
+
+		const auto Error{(TableValues - EvaluateCurves(GaitAmount)).GetAbs()};
+
+		MaxError = MaxError.ComponentMax(Error);
+	}
+
+	UE_LOG(LogAls, Verbose, TEXT("Baked the %s curve into a lookup table with %d samples. Maximum error: %s."),
+	       *AccelerationAndDecelerationAndGroundFrictionCurve->GetName(), Resolution, *MaxError.ToString());
+}
+
+#if WITH_EDITOR
+bool FAlsMovementGaitSettings::IsAccelerationAndDecelerationAndGroundFrictionTableStale() const
+{
+	const auto CurveHash{
+		IsValid(AccelerationAndDecelerationAndGroundFrictionCurve)
+			? AlsMovementSettings::CalculateCurveHash(*AccelerationAndDecelerationAndGroundFrictionCurve)
+			: 0
+	};
+
+	return AccelerationAndDecelerationAndGroundFrictionTableCurveHash != CurveHash;
+}
+#endif
+
+void UAlsMovementSettings::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	CompileGaitSettings();
+}
+
+void UAlsMovementSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileGaitSettings();
+}
+
 #if WITH_EDITOR
 void UAlsMovementSettings::PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent)
 {
@@ -11,6 +145,95 @@ void UAlsMovementSettings::PostEditChangeProperty(FPropertyChangedEvent& Changed
 		                                                      VelocityAngleToSpeedInterpolationRange.Y);
 	}
 
+	CompileGaitSettings();
+
 	Super::PostEditChangeProperty(ChangedEvent);
 }
+
+void UAlsMovementSettings::PostEditUndo()
+{
+	Super::PostEditUndo();
+
+	CompileGaitSettings();
+}
+#endif
+
+void UAlsMovementSettings::CompileGaitSettings()
+{
+	CompiledRotationModes.Reset();
+	CompiledStances.Reset();
+	CompiledGaitSettings.Reset();
+	CompiledGaitSettingsIndices.Reset();
+
+	for (auto& RotationMode : RotationModes)
+	{
+		CompiledRotationModes.Add(RotationMode.Key);
+
+		for (auto& Stance : RotationMode.Value.Stances)
+		{
+			CompiledStances.AddUnique(Stance.Key);
+
+			Stance.Value.BakeAccelerationAndDecelerationAndGroundFrictionTable(CurveTableResolution);
+		}
+	}
+
+	CompiledGaitSettingsIndices.Init(INDEX_NONE, CompiledRotationModes.Num() * CompiledStances.Num());
+
+	for (auto i{0}; i < CompiledRotationModes.Num(); i++)
+	{
+		const auto& Stances{RotationModes.FindChecked(CompiledRotationModes[i]).Stances};
+
+		for (auto j{0}; j < CompiledStances.Num(); j++)
+		{
+			const auto* GaitSettings{Stances.Find(CompiledStances[j])};
+			if (GaitSettings != nullptr)
+			{
+				CompiledGaitSettingsIndices[i * CompiledStances.Num() + j] = CompiledGaitSettings.Add(*GaitSettings);
+			}
+		}
+	}
+
+	CompiledGaitSettingsRevision += 1;
+}
+
+#if WITH_EDITOR
+void UAlsMovementSettings::RecompileGaitSettingsIfCurvesChanged()
+{
+	if (CurvesCheckFrameNumber == GFrameCounter)
+	{
+		return;
+	}
+
+	CurvesCheckFrameNumber = GFrameCounter;
+
+	for (const auto& RotationMode : RotationModes)
+	{
+		for (const auto& Stance : RotationMode.Value.Stances)
+		{
+			if (Stance.Value.IsAccelerationAndDecelerationAndGroundFrictionTableStale())
+			{
+				UE_LOG(LogAls, Verbose, TEXT("The gait settings curves of %s have changed, recompiling the gait settings."), *GetName());
+
+				CompileGaitSettings();
+				return;
+			}
+		}
+	}
+}
 #endif
+
+const FAlsMovementGaitSettings* UAlsMovementSettings::FindGaitSettings(const FGameplayTag& RotationMode, const FGameplayTag& Stance) const
+{
+	// There are only a few rotation modes and stances, so a linear search is faster than hashing here.
+
+	const auto RotationModeIndex{CompiledRotationModes.IndexOfByKey(RotationMode)};
+	const auto StanceIndex{CompiledStances.IndexOfByKey(Stance)};
+
+	const auto GaitSettingsIndex{
+		RotationModeIndex != INDEX_NONE && StanceIndex != INDEX_NONE
+			? CompiledGaitSettingsIndices[RotationModeIndex * CompiledStances.Num() + StanceIndex]
+			: INDEX_NONE
+	};
+
+	return CompiledGaitSettings.IsValidIndex(GaitSettingsIndex) ? &CompiledGaitSettings[GaitSettingsIndex] : nullptr;
+}
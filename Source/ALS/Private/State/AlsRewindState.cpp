@@ -0,0 +1,97 @@
+﻿#include "State/AlsRewindState.h"
+
+#include "Utility/AlsRotation.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AlsRewindState)
+
+void FAlsRewindHistory::Initialize(const int32 Capacity)
+{
+	Snapshots.Reset();
+	Snapshots.SetNum(FMath::Max(1, Capacity));
+
+	Reset();
+}
+
+FAlsRewindSnapshot& FAlsRewindHistory::AddSnapshot()
+{
+	check(!Snapshots.IsEmpty())
+
+	if (SnapshotsCount < Snapshots.Num())
+	{
+		SnapshotsCount += 1;
+	}
+	else
+	{
+		OldestIndex = (OldestIndex + 1) % Snapshots.Num();
+	}
+
+	return Snapshots[(OldestIndex + SnapshotsCount - 1) % Snapshots.Num()];
+}
+
+bool FAlsRewindHistory::Query(const double Time, FAlsRewindSnapshot& OutSnapshot) const
+{
+	if (IsEmpty())
+	{
+		return false;
+	}
+
+	if (Time <= GetSnapshot(0).ServerTime)
+	{
+		OutSnapshot = GetSnapshot(0);
+		return true;
+	}
+
+	if (Time >= GetNewestSnapshot().ServerTime)
+	{
+		OutSnapshot = GetNewestSnapshot();
+		return true;
+	}
+
+	// Find the newest snapshot that is not newer than the given time.
+
+	auto MinIndex{0};
+	auto MaxIndex{SnapshotsCount - 1};
+
+	while (MaxIndex - MinIndex > 1)
+	{
+		const auto MiddleIndex{(MinIndex + MaxIndex) / 2};
+
+		if (GetSnapshot(MiddleIndex).ServerTime <= Time)
+		{
+			MinIndex = MiddleIndex;
+		}
+		else
+		{
+			MaxIndex = MiddleIndex;
+		}
+	}
+
+	const auto& From{GetSnapshot(MinIndex)};
+	const auto& To{GetSnapshot(MaxIndex)};
+
+	const auto TimeDelta{To.ServerTime - From.ServerTime};
+	const auto Alpha{TimeDelta > UE_SMALL_NUMBER ? UE_REAL_TO_FLOAT((Time - From.ServerTime) / TimeDelta) : 1.0f};
+
+	OutSnapshot.ServerTime = Time;
+	OutSnapshot.Location = FMath::Lerp(From.Location, To.Location, Alpha);
+	OutSnapshot.Rotation = FQuat::Slerp(From.Rotation, To.Rotation, Alpha);
+	OutSnapshot.CapsuleRadius = FMath::Lerp(From.CapsuleRadius, To.CapsuleRadius, Alpha);
+	OutSnapshot.CapsuleHalfHeight = FMath::Lerp(From.CapsuleHalfHeight, To.CapsuleHalfHeight, Alpha);
+	OutSnapshot.ViewRotation = UAlsRotation::LerpRotation(From.ViewRotation, To.ViewRotation, Alpha);
+
+	// Tags can't be interpolated, so take them from the nearest snapshot.
+
+	const auto& Nearest{Alpha < 0.5f ? From : To};
+
+	OutSnapshot.Stance = Nearest.Stance;
+	OutSnapshot.LocomotionAction = Nearest.LocomotionAction;
+
+	OutSnapshot.BonesCount = FMath::Min(From.BonesCount, To.BonesCount);
+
+	for (auto i{0}; i < OutSnapshot.BonesCount; i++)
+	{
+		OutSnapshot.BoneTransforms[i].Blend(From.BoneTransforms[i], To.BoneTransforms[i], Alpha);
+	}
+
+	return true;
+}
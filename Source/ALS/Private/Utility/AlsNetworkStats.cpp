@@ -0,0 +1,10 @@
+﻿#include "Utility/AlsNetworkStats.h"
+
+DEFINE_STAT(STAT_AlsNetwork_RpcsExecuted)
+DEFINE_STAT(STAT_AlsNetwork_PackedMovesSent)
+DEFINE_STAT(STAT_AlsNetwork_PackedMoveBitsSent)
+DEFINE_STAT(STAT_AlsNetwork_MantlingValidations)
+DEFINE_STAT(STAT_AlsNetwork_MantlingValidationTraces)
+DEFINE_STAT(STAT_AlsNetwork_MantlingRejections)
+
+CSV_DEFINE_CATEGORY_MODULE(ALS_API, AlsNetwork, false);
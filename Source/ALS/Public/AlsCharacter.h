@@ -4,15 +4,16 @@
 #include "State/AlsLocomotionState.h"
 #include "State/AlsMantlingState.h"
 #include "State/AlsMovementBaseState.h"
+#include "State/AlsNetworkActionState.h"
 #include "State/AlsRagdollingState.h"
+#include "State/AlsReplayState.h"
+#include "State/AlsRewindState.h"
 #include "State/AlsRollingState.h"
 #include "State/AlsViewState.h"
 #include "State/AlsFlightState.h"
 #include "Utility/AlsGameplayTags.h"
 #include "AlsCharacter.generated.h"
 
-enum class EAlsMantlingType : uint8;
-struct FAlsMantlingParameters;
 struct FAlsMantlingTraceSettings;
 class UAlsCharacterMovementComponent;
 class UAlsCharacterSettings;
@@ -37,6 +38,8 @@ public:
 #endif
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplicationForReplay(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+	virtual bool IsNetRelevantFor(const AActor* RealViewer, const AActor* ViewTarget, const FVector& SrcLocation) const override;
 	virtual void PreRegisterAllComponents() override;
 	virtual void PostRegisterAllComponents() override;
 	virtual void PostInitializeComponents() override;
@@ -72,6 +75,15 @@ private:
 
 	void RefreshMovementBase();
 
+public:
+	// Called by the character movement component after each movement update.
+	void RefreshMovementBaseSnapshot();
+
+	// Returns the movement base transform from the snapshot taken after the movement update in the current frame, allowing
+	// the character, the animation instance and the camera to avoid resolving the movement base transform separately.
+	bool TryGetCurrentMovementBaseTransform(FVector& OutLocation, FQuat& OutRotation) const;
+
+private:
 	void RefreshInput(float DeltaTime);
 
 public:
@@ -235,6 +247,12 @@ private:
 	UFUNCTION()
 	void OnReplicated_ReplicatedViewRotation();
 
+	UFUNCTION()
+	void OnReplicated_NetworkAction(const FAlsNetworkActionState& PreviousNetworkAction);
+
+	UFUNCTION()
+	void OnReplicated_ReplayState();
+
 public:
 	void CorrectViewNetworkSmoothing(const FRotator& NewTargetRotation, bool bRelativeTargetRotation);
 
@@ -301,8 +319,8 @@ protected:
 	/*		Jumping			*/
 	/************************/
 private:
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastOnJumpedNetworked();
+	UFUNCTION()
+	void OnReplicated_JumpsCount(uint8 PreviousJumpsCount);
 
 	void OnJumpedNetworked();
 
@@ -324,6 +342,33 @@ protected:
 	float FlightTrace(float Distance, const FVector& Direction);
 
 
+	/************************/
+	/*	  Network Actions	*/
+	/************************/
+public:
+	// On the server, validates and starts the action and replicates it to simulated proxies. On the autonomous
+	// proxy, predicts the action and sends it to the server as part of the next move instead of a separate RPC.
+	void StartNetworkAction(FAlsNetworkAction Action);
+
+private:
+	bool StartNetworkActionImplementation(const FAlsNetworkAction& Action);
+
+	void SetNetworkAction(const FAlsNetworkAction& NewAction, bool bSendEvent);
+
+	// Unreliable and sent only to clients within the event cull distance. If the event is lost or dropped
+	// as stale, the client will still receive the action through the replicated network action state.
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastNetworkActionEvent(const FAlsNetworkActionState& State);
+
+	void ApplyNetworkAction(const FAlsNetworkActionState& State);
+
+	float CalculateNetworkActionAge(const FAlsNetworkActionState& State) const;
+
+	void FastForwardNetworkAction(const FAlsNetworkAction& Action, float Time);
+
+	void RefreshNetworkActionOnLocomotionActionChanged();
+
+
 	/************************/
 	/*		Rolling			*/
 	/************************/
@@ -339,13 +384,7 @@ public:
 private:
 	void StartRolling(float PlayRate, float TargetYawAngle);
 
-	UFUNCTION(Server, Reliable)
-	void ServerStartRolling(UAnimMontage* Montage, float PlayRate, float InitialYawAngle, float TargetYawAngle);
-
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStartRolling(UAnimMontage* Montage, float PlayRate, float InitialYawAngle, float TargetYawAngle);
-
-	void StartRollingImplementation(UAnimMontage* Montage, float PlayRate, float InitialYawAngle, float TargetYawAngle);
+	bool StartRollingImplementation(const FAlsRollingParameters& Parameters);
 
 	void RefreshRolling(float DeltaTime);
 
@@ -362,18 +401,21 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Character", Meta = (ReturnDisplayName = "Success"))
 	bool StartMantlingGrounded();
 
+	const UAlsMantlingSettings* GetMantlingSettingsByIndex(uint8 Index) const;
+
 private:
 	bool StartMantlingInAir();
 
 	bool StartMantling(const FAlsMantlingTraceSettings& TraceSettings);
 
-	UFUNCTION(Server, Reliable)
-	void ServerStartMantling(const FAlsMantlingParameters& Parameters);
+	bool TraceMantling(const FAlsMantlingTraceSettings& TraceSettings, FAlsMantlingParameters& OutParameters);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStartMantling(const FAlsMantlingParameters& Parameters);
+	// Used by the server to validate mantling parameters received from the client.
+	bool ValidateMantlingParameters(const FAlsMantlingParameters& Parameters);
+
+	bool StartMantlingImplementation(const FAlsMantlingParameters& Parameters);
 
-	void StartMantlingImplementation(const FAlsMantlingParameters& Parameters);
+	uint8 GetOrAddMantlingSettingsIndex(const UAlsMantlingSettings* MantlingSettings);
 
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
@@ -408,10 +450,7 @@ private:
 	UFUNCTION(Server, Reliable)
 	void ServerStartRagdolling();
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStartRagdolling();
-
-	void StartRagdollingImplementation();
+	bool StartRagdollingImplementation();
 
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Als Character")
@@ -427,9 +466,6 @@ private:
 	UFUNCTION(Server, Reliable)
 	void ServerStopRagdolling();
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStopRagdolling();
-
 	void StopRagdollingImplementation();
 
 protected:
@@ -452,6 +488,33 @@ private:
 	void RefreshRagdolling(float DeltaTime);
 
 
+	/************************/
+	/*		Rewind			*/
+	/************************/
+public:
+	// Called by the rewind subsystem at the end of each server tick.
+	void RecordRewindSnapshot(double ServerTime);
+
+	// Valid only on the server and only if the rewind history is enabled in the character settings.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Character", Meta = (ReturnDisplayName = "Success"))
+	bool TryGetRewindSnapshot(double Time, FAlsRewindSnapshot& OutSnapshot) const;
+
+
+	/************************/
+	/*		Proxy Updates	*/
+	/************************/
+public:
+	bool IsUsingReducedProxyUpdates() const;
+
+protected:
+	// Decides whether the simulated proxy should use reduced updates. By default, it is based on the distance to the
+	// nearest local player's view point. Override this to use a different metric, such as significance.
+	virtual bool ShouldUseReducedProxyUpdates() const;
+
+private:
+	void RefreshReducedProxyUpdates();
+
+
 	/************************/
 	/*		Camera			*/
 	/************************/
@@ -480,6 +543,8 @@ private:
 
 	void DisplayDebugMantling(const UCanvas* Canvas, float Scale, float HorizontalLocation, float& VerticalLocation) const;
 
+	void DisplayDebugCorrections(const UCanvas* Canvas, float Scale, float HorizontalLocation, float& VerticalLocation) const;
+
 
 	/************************/
 	/*		Delegates		*/
@@ -548,6 +613,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsMovementBaseState MovementBase;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	FAlsMovementBaseState MovementBaseSnapshot;
+
 	// Replicated raw view rotation. Depending on the context, this rotation can be in world space, or in movement
 	// base space. In most cases, it is better to use FAlsViewState::Rotation to take advantage of network smoothing.
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
@@ -557,6 +625,10 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsViewState ViewState;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
+		ReplicatedUsing = "OnReplicated_ReplayState")
+	FAlsReplayState ReplayState;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Replicated)
 	FVector_NetQuantizeNormal InputDirection;
 
@@ -585,5 +657,49 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
 	FAlsRollingState RollingState;
 
+	// Mantling settings used by the character so far, filled by the server on first use of each mantling settings asset. Allows
+	// mantling root motion sources to reference mantling settings by index instead of by object reference during network serialization.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, Replicated)
+	TArray<TObjectPtr<const UAlsMantlingSettings>> MantlingSettingsTable;
+
+	// Incremented by the server on each jump, so that simulated proxies can play the jump animation
+	// without a dedicated RPC. Only the fact of change matters, so the value is allowed to wrap around.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
+		ReplicatedUsing = "OnReplicated_JumpsCount")
+	uint8 JumpsCount{0};
+
+	// The last action started by the server. Also serves as a fallback for clients that missed the action
+	// event, or joined after it was sent. The owning client ignores rolling and mantling, since it
+	// predicts them itself and sends them to the server in move data.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient,
+		ReplicatedUsing = "OnReplicated_NetworkAction")
+	FAlsNetworkActionState NetworkAction;
+
+	// Valid only on clients. Identifier of the last network action received either from an action event or from the replicated state.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	uint8 AppliedNetworkActionId{0};
+
+	// Valid only on clients. Whether any network action state has been applied yet, i.e. whether AppliedNetworkActionId is meaningful.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient)
+	uint8 bNetworkActionApplied : 1 {false};
+
+	// Set only while the action event is being sent, so that IsNetRelevantFor() applies the event cull distance.
+	uint8 bSendingNetworkActionEvent : 1 {false};
+
 	FTimerHandle BrakingFrictionFactorResetTimer;
-};
\ No newline at end of file
+
+	FAlsRewindHistory RewindHistory;
+
+	double NextRewindRecordTime{0.0};
+
+	// Valid only on simulated proxies. If set, the state of the character is refreshed at a reduced rate.
+	uint8 bReducedProxyUpdates : 1 {false};
+
+	// Time elapsed since the last full refresh of the character state. Used as the delta time of the refresh.
+	float PendingRefreshDeltaTime{0.0f};
+};
+
+inline bool AAlsCharacter::IsUsingReducedProxyUpdates() const
+{
+	return bReducedProxyUpdates;
+}
\ No newline at end of file
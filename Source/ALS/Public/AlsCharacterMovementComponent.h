@@ -2,6 +2,8 @@
 
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Settings/AlsMovementSettings.h"
+#include "State/AlsMovementCorrectionState.h"
+#include "State/AlsNetworkActionState.h"
 #include "AlsCharacterMovementComponent.generated.h"
 
 using FAlsPhysicsRotationDelegate = TMulticastDelegate<void(float DeltaTime)>;
@@ -18,10 +20,16 @@ public:
 
 	FGameplayTag MaxAllowedGait{AlsGaitTags::Running};
 
+	FAlsNetworkAction Action;
+
 public:
 	virtual void ClientFillNetworkMoveData(const FSavedMove_Character& Move, ENetworkMoveType MoveType) override;
 
 	virtual bool Serialize(UCharacterMovementComponent& Movement, FArchive& Archive, UPackageMap* Map, ENetworkMoveType MoveType) override;
+
+	// Applies the same quantization to the action parameters that the serialization does, so that
+	// the client can predict the action using exactly the same values that the server will receive.
+	static void QuantizeAction(FAlsNetworkAction& Action);
 };
 
 class ALS_API FAlsCharacterNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
@@ -45,9 +53,13 @@ public:
 
 	FGameplayTag MaxAllowedGait{AlsGaitTags::Running};
 
+	FAlsNetworkAction Action;
+
 public:
 	virtual void Clear() override;
 
+	virtual bool IsImportantMove(const FSavedMovePtr& LastAckedMove) const override;
+
 	virtual void SetMoveFor(ACharacter* Character, float NewDeltaTime, const FVector& NewAcceleration,
 	                        FNetworkPredictionData_Client_Character& PredictionData) override;
 
@@ -70,6 +82,32 @@ public:
 	virtual FSavedMovePtr AllocateNewMove() override;
 };
 
+// Floor result of the last floor query, along with everything the result depends on.
+struct ALS_API FAlsFloorCache
+{
+	FFindFloorResult FloorResult;
+
+	TWeakObjectPtr<const UPrimitiveComponent> Base;
+
+	FVector CapsuleLocation{ForceInit};
+
+	float CapsuleRadius{0.0f};
+
+	float CapsuleHalfHeight{0.0f};
+
+	float LineDistance{0.0f};
+
+	float SweepDistance{0.0f};
+
+	float SweepRadius{0.0f};
+
+	ECollisionChannel CollisionChannel{ECC_Pawn};
+
+	double Time{0.0};
+
+	bool bValid{false};
+};
+
 UCLASS(ClassGroup = "ALS")
 class ALS_API UAlsCharacterMovementComponent : public UCharacterMovementComponent
 {
@@ -83,6 +121,42 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Settings", Transient)
 	uint8 bAllowImprovedPenetrationAdjustment : 1 {true};
 
+	// If checked, the floor result is reused while the character stays still on static geometry, which allows skipping floor sweeps.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	uint8 bAllowFloorCache : 1 {true};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+		Meta = (ClampMin = 0, EditCondition = "bAllowFloorCache", ForceUnits = "cm"))
+	float FloorCacheLocationTolerance{0.1f};
+
+	// The cached floor result is discarded after this time to pick up changes that the cache doesn't track, such as newly spawned actors.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+		Meta = (ClampMin = 0, EditCondition = "bAllowFloorCache", ForceUnits = "s"))
+	float FloorCacheMaxAge{0.5f};
+
+	// If checked, grounded AI-controlled characters use the nav mesh walking movement mode, which projects the character
+	// onto the nav mesh instead of sweeping for the floor. The regular walking movement mode is used when players or
+	// dynamic obstacles are nearby, or when the character is driven by root motion, such as during mantling or rolling.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	uint8 bAllowCrowdNavWalking : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+		Meta = (ClampMin = 0, EditCondition = "bAllowCrowdNavWalking", ForceUnits = "cm"))
+	float CrowdNavWalkingPlayerDistance{2000.0f};
+
+	// Distance around the capsule in which dynamic and physics bodies prevent the use of the nav mesh walking movement mode.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+		Meta = (ClampMin = 0, EditCondition = "bAllowCrowdNavWalking", ForceUnits = "cm"))
+	float CrowdNavWalkingObstacleDistance{100.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings",
+		Meta = (ClampMin = 0, EditCondition = "bAllowCrowdNavWalking", ForceUnits = "s"))
+	float CrowdNavWalkingRefreshInterval{0.25f};
+
+	// A warning is logged when replaying the saved moves after a correction takes longer than this time. Zero disables the warning.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "ms"))
+	float MoveReplayTimeBudget{0.0f};
+
 protected:
 	FAlsCharacterNetworkMoveDataContainer MoveDataContainer;
 
@@ -92,6 +166,18 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FAlsMovementGaitSettings GaitSettings;
 
+	// Tags and the movement settings revision for which the gait settings above were last resolved. Used to skip resolving
+	// and copying the gait settings when nothing has changed. No pointer to the resolved gait settings is kept, since it
+	// would dangle as soon as the movement settings are recompiled.
+
+	uint8 bGaitSettingsResolved : 1 {false};
+
+	FGameplayTag ResolvedRotationMode;
+
+	FGameplayTag ResolvedStance;
+
+	uint32 ResolvedGaitSettingsRevision{0};
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FGameplayTag RotationMode{AlsRotationModeTags::ViewDirection};
 
@@ -127,6 +213,25 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bPrePenetrationAdjustmentVelocityValid : 1 {false};
 
+	// Valid only on autonomous proxies. An action predicted by the client since the
+	// last saved move, which will be sent to the server as part of the next move.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsNetworkAction PendingNetworkAction;
+
+	// Mutable because the cache is refreshed by the floor queries, which are const.
+	mutable FAlsFloorCache FloorCache;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "s"))
+	float CrowdNavWalkingRefreshTimeRemaining{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsMovementCorrectionState CorrectionState;
+
+	// Valid only on the server. State change made by the client in the current
+	// move, reported along with the correction if the move results in one.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	EAlsMovementCorrectionCause MoveStateChange{EAlsMovementCorrectionCause::None};
+
 public:
 	FAlsPhysicsRotationDelegate OnPhysicsRotation;
 
@@ -139,12 +244,16 @@ public:
 
 	virtual void BeginPlay() override;
 
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
 	virtual FVector ConsumeInputVector() override;
 
 	virtual void SetMovementMode(EMovementMode NewMovementMode, uint8 NewCustomMode = 0) override;
 
 	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
 
+	virtual void OnTeleported() override;
+
 	virtual bool ShouldPerformAirControlForPathFollowing() const override;
 
 	virtual void UpdateBasedRotation(FRotator& FinalRotation, const FRotator& ReducedRotation) override;
@@ -176,9 +285,27 @@ public:
 	virtual void ComputeFloorDist(const FVector& CapsuleLocation, float LineDistance, float SweepDistance, FFindFloorResult& OutFloorResult,
 	                              float SweepRadius, const FHitResult* DownwardSweepResult) const override;
 
+private:
+	void ComputeFloorDistUncached(const FVector& CapsuleLocation, float LineDistance, float SweepDistance,
+	                              FFindFloorResult& OutFloorResult, float SweepRadius, const FHitResult* DownwardSweepResult) const;
+
+	bool TryGetCachedFloor(const FVector& CapsuleLocation, float LineDistance, float SweepDistance,
+	                       float SweepRadius, FFindFloorResult& OutFloorResult) const;
+
+	void RefreshFloorCache(const FVector& CapsuleLocation, float LineDistance, float SweepDistance,
+	                       float SweepRadius, const FFindFloorResult& FloorResult) const;
+
+public:
+	void InvalidateFloorCache();
+
 protected:
 	virtual void PerformMovement(float DeltaTime) override;
 
+private:
+	void RefreshCrowdNavWalking(float DeltaTime);
+
+	bool CanUseCrowdNavWalking() const;
+
 public:
 	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
 
@@ -187,6 +314,22 @@ protected:
 
 	virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAcceleration) override;
 
+	virtual void ServerMovePacked_ClientSend(const FCharacterServerMovePackedBits& PackedBits) override;
+
+	virtual bool ServerCheckClientError(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FVector& ClientWorldLocation,
+	                                    const FVector& RelativeClientLocation, UPrimitiveComponent* ClientMovementBase,
+	                                    FName ClientBaseBoneName, uint8 ClientMovementMode) override;
+
+	virtual void OnClientCorrectionReceived(FNetworkPredictionData_Client_Character& ClientData, float TimeStamp,
+	                                        FVector NewLocation, FVector NewVelocity, UPrimitiveComponent* NewBase,
+	                                        FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition,
+	                                        uint8 ServerMovementMode, FVector ServerGravityDirection) override;
+
+public:
+	virtual bool ClientUpdatePositionAfterServerUpdate() override;
+
+	const FAlsMovementCorrectionState& GetCorrectionState() const;
+
 private:
 	void SavePenetrationAdjustment(const FHitResult& Hit);
 
@@ -227,8 +370,20 @@ public:
 	void SetInputBlocked(bool bNewInputBlocked);
 
 	bool TryConsumePrePenetrationAdjustmentVelocity(FVector& OutVelocity);
+
+	void SetPendingNetworkAction(const FAlsNetworkAction& NewAction);
 };
 
+inline void UAlsCharacterMovementComponent::InvalidateFloorCache()
+{
+	FloorCache.bValid = false;
+}
+
+inline const FAlsMovementCorrectionState& UAlsCharacterMovementComponent::GetCorrectionState() const
+{
+	return CorrectionState;
+}
+
 inline const FAlsMovementGaitSettings& UAlsCharacterMovementComponent::GetGaitSettings() const
 {
 	return GaitSettings;
@@ -258,3 +413,8 @@ inline float UAlsCharacterMovementComponent::GetGaitAmount() const
 {
 	return GaitAmount;
 }
+
+inline void UAlsCharacterMovementComponent::SetPendingNetworkAction(const FAlsNetworkAction& NewAction)
+{
+	PendingNetworkAction = NewAction;
+}
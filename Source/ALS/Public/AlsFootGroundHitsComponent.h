@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "HAL/CriticalSection.h"
+#include "State/AlsFootGroundHitState.h"
+#include "AlsFootGroundHitsComponent.generated.h"
+
+// Stores the most recent ground hits of the owner's feet, so that the foot offset trace rig unit can share its ground traces with
+// footstep effects, which then don't have to trace again. Sharing is enabled only if this component is added to the owner.
+UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent))
+class ALS_API UAlsFootGroundHitsComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+private:
+	// Written during animation evaluation, so access it only through SetFootGroundHit() and TryGetRecentFootGroundHit().
+	TArray<FAlsFootGroundHitState, TInlineAllocator<2>> FootGroundHits;
+
+	mutable FCriticalSection FootGroundHitsLock;
+
+public:
+	UAlsFootGroundHitsComponent();
+
+	// Thread safe. Called by the foot offset trace rig unit during animation evaluation.
+	void SetFootGroundHit(const FName& FootBoneName, const FHitResult& Hit, ECollisionChannel TraceChannel);
+
+	// Thread safe. Returns the foot ground hit if it is a blocking hit traced on the
+	// specified channel and it was recorded in the current or previous frame.
+	bool TryGetRecentFootGroundHit(const FName& FootBoneName, ECollisionChannel TraceChannel, FHitResult& OutHit) const;
+};
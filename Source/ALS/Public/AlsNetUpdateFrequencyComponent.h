@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Components/ActorComponent.h"
+#include "Settings/AlsNetUpdateFrequencySettings.h"
+#include "AlsNetUpdateFrequencyComponent.generated.h"
+
+class AAlsCharacter;
+
+// Adjusts the owner's net update frequency on the server depending on what the character is currently
+// doing, so that idle characters replicate rarely and characters performing actions replicate often.
+UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent))
+class ALS_API UAlsNetUpdateFrequencyComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	TObjectPtr<UAlsNetUpdateFrequencySettings> Settings;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TObjectPtr<AAlsCharacter> Character;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	EAlsNetUpdateActivity Activity{EAlsNetUpdateActivity::Idle};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "s"))
+	float DemotionTimeRemaining{0.0f};
+
+public:
+	UAlsNetUpdateFrequencyComponent();
+
+	virtual void OnRegister() override;
+
+	virtual void RegisterComponentTickFunctions(bool bRegister) override;
+
+protected:
+	virtual void BeginPlay() override;
+
+public:
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	EAlsNetUpdateActivity GetActivity() const;
+
+private:
+	EAlsNetUpdateActivity CalculateActivity() const;
+
+	void SetActivity(EAlsNetUpdateActivity NewActivity);
+};
+
+inline EAlsNetUpdateActivity UAlsNetUpdateFrequencyComponent::GetActivity() const
+{
+	return Activity;
+}
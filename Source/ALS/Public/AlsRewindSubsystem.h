@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Subsystems/WorldSubsystem.h"
+#include "State/AlsRewindState.h"
+#include "AlsRewindSubsystem.generated.h"
+
+class AAlsCharacter;
+
+// Records the rewind history of all registered characters at the end of each server
+// tick, and allows to rewind many characters at once, for example, for hit validation.
+UCLASS()
+class ALS_API UAlsRewindSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+protected:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	TArray<TWeakObjectPtr<AAlsCharacter>> Characters;
+
+	FDelegateHandle WorldPostActorTickHandle;
+
+protected:
+	virtual bool DoesSupportWorldType(EWorldType::Type WorldType) const override;
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+	void RegisterCharacter(AAlsCharacter* Character);
+
+	// Interpolates the rewind history of all registered characters at the given server time. The output
+	// array is reset but not shrunk, so reusing it between calls avoids memory allocations.
+	void RewindCharacters(double Time, TArray<TPair<AAlsCharacter*, FAlsRewindSnapshot>>& OutSnapshots) const;
+
+private:
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaTime);
+};
@@ -27,6 +27,15 @@ public:
 	UPROPERTY(Meta = (Input))
 	bool bEnabled{true};
 
+	// If enabled, the ground hit is shared through the owner's foot ground hits component, if it has one, so that footstep
+	// effects can reuse it instead of tracing again. Footstep effects only reuse blocking hits traced on their own surface trace channel.
+	UPROPERTY(Meta = (Input))
+	bool bShareGroundHit{false};
+
+	// Name of the foot bone used by footstep effects for this foot. Must be set explicitly to share the ground hit.
+	UPROPERTY(Meta = (Input))
+	FName FootBoneName;
+
 	UPROPERTY(meta = (Input, DetailsOnly))
 	bool bDrawDebug{false};
 
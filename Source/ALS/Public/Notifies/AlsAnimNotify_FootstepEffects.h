@@ -7,6 +7,7 @@
 
 enum EPhysicalSurface : int;
 struct FHitResult;
+struct FStreamableHandle;
 class USoundBase;
 class UMaterialInterface;
 class UNiagaraSystem;
@@ -190,10 +191,41 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ForceInlineRow))
 	TMap<TEnumAsByte<EPhysicalSurface>, FAlsFootstepEffectSettings> Effects;
 
+private:
+	// Copies of the effect settings from the effects map. Copies are used instead of pointers
+	// to the map values, because the map storage may be reallocated, for example on undo.
+	TArray<FAlsFootstepEffectSettings> CompiledEffects;
+
+	// Indices of the compiled effect settings, indexed by surface type.
+	TArray<int32> CompiledEffectIndices;
+
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+
+	uint8 bPreloadRequested : 1 {false};
+
 public:
+	virtual void PostInitProperties() override;
+
+	virtual void PostLoad() override;
+
+	virtual void BeginDestroy() override;
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent) override;
+
+	virtual void PostEditUndo() override;
 #endif
+
+	const FAlsFootstepEffectSettings* FindEffectSettings(EPhysicalSurface SurfaceType) const;
+
+	// Asynchronously loads all effect assets, so that footsteps never have to load them synchronously.
+	void PreloadEffects();
+
+private:
+	void CompileEffects();
+
+	// Releases the preloaded effect assets, so that they can be unloaded once nothing else references them.
+	void ReleasePreloadedEffects();
 };
 
 UCLASS(DisplayName = "Als Footstep Effects Animation Notify",
@@ -4,6 +4,7 @@
 #include "AlsRootMotionSource_Mantling.generated.h"
 
 class UAlsMantlingSettings;
+class AAlsCharacter;
 
 USTRUCT()
 struct ALS_API FAlsRootMotionSource_Mantling : public FRootMotionSource
@@ -11,9 +12,18 @@ struct ALS_API FAlsRootMotionSource_Mantling : public FRootMotionSource
 	GENERATED_BODY()
 
 public:
+	static constexpr uint8 InvalidMantlingSettingsIndex{MAX_uint8};
+
+	// Can be null on clients after network serialization until the mantling
+	// settings index is resolved using the character's mantling settings table.
 	UPROPERTY()
 	TObjectPtr<const UAlsMantlingSettings> MantlingSettings;
 
+	// Index of the mantling settings in the character's mantling settings table. If valid, the network serialization sends
+	// only this index instead of the mantling settings object reference and skips the fields derived from the settings.
+	UPROPERTY()
+	uint8 MantlingSettingsIndex{InvalidMantlingSettingsIndex};
+
 	UPROPERTY()
 	TWeakObjectPtr<const UPrimitiveComponent> TargetPrimitive;
 
@@ -52,6 +62,9 @@ public:
 	virtual FString ToSimpleString() const override;
 
 	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+private:
+	bool TryResolveMantlingSettings(const ACharacter& Character);
 };
 
 template <>
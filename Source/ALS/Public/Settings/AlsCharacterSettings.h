@@ -3,7 +3,10 @@
 #include "AlsInAirRotationMode.h"
 #include "AlsFlightSettings.h"
 #include "AlsMantlingSettings.h"
+#include "AlsNetworkActionSettings.h"
+#include "AlsProxySettings.h"
 #include "AlsRagdollingSettings.h"
+#include "AlsRewindSettings.h"
 #include "AlsRollingSettings.h"
 #include "AlsViewSettings.h"
 #include "AlsCharacterSettings.generated.h"
@@ -62,6 +65,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsRollingSettings Rolling;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsNetworkActionSettings NetworkActions;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsRewindSettings Rewind;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsProxySettings Proxy;
+
 public:
 	UAlsCharacterSettings();
 
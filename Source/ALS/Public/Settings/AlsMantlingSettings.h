@@ -139,6 +139,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	uint8 bStartRagdollingOnTargetPrimitiveDestruction : 1 {true};
 
+	// If checked, the server validates the mantling parameters received from clients before starting mantling.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bValidateClientMantling : 1 {true};
+
+	// Used to compensate for differences between the client and server when validating mantling parameters.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, ForceUnits = "cm", EditCondition = "bValidateClientMantling"))
+	float ValidationTolerance{25.0f};
+
+	// The maximum number of full mantling traces per second the server can perform for each client when the
+	// mantling parameters received from the client look suspicious. Suspicious parameters are rejected otherwise.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, EditCondition = "bValidateClientMantling"))
+	float MaxValidationTracesPerSecond{2.0f};
+
 public:
 #if WITH_EDITOR
 	void PostEditChangeProperty(const FPropertyChangedEvent& ChangedEvent);
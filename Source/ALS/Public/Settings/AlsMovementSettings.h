@@ -39,15 +39,37 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UCurveVector> AccelerationAndDecelerationAndGroundFrictionCurve;
 
+	// Acceleration, deceleration, and ground friction curve baked into a uniform lookup table over the gait amount range.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", AdvancedDisplay, Transient)
+	TArray<FVector3f> AccelerationAndDecelerationAndGroundFrictionTable;
+
+	// Maximum absolute difference between the lookup table and the curve, measured for each channel separately.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ALS", AdvancedDisplay, Transient)
+	FVector3f AccelerationAndDecelerationAndGroundFrictionTableMaxError{ForceInit};
+
 	// Gait amount to rotation interpolation speed curve.
 	// Gait amount ranges from 0 to 3, where 0 is stopped, 1 is walking, 2 is running, and 3 is sprinting.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TObjectPtr<UCurveFloat> RotationInterpolationSpeedCurve;
 
+#if WITH_EDITORONLY_DATA
+	// Hash of the curve keys from which the lookup table was baked. Used to detect that the curve was edited after baking.
+	uint32 AccelerationAndDecelerationAndGroundFrictionTableCurveHash{0};
+#endif
+
 public:
 	float GetMaxWalkSpeed() const;
 
 	float GetMaxRunSpeed() const;
+
+	void BakeAccelerationAndDecelerationAndGroundFrictionTable(int32 Resolution);
+
+#if WITH_EDITOR
+	bool IsAccelerationAndDecelerationAndGroundFrictionTableStale() const;
+#endif
+
+	// Returns false if the lookup table is not baked.
+	bool TrySampleAccelerationAndDecelerationAndGroundFriction(float GaitAmount, FVector3f& OutValues) const;
 };
 
 USTRUCT(BlueprintType)
@@ -74,6 +96,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 180, ForceUnits = "deg"))
 	FVector2f VelocityAngleToSpeedInterpolationRange{100.0f, 125.0f};
 
+	// Number of samples in the lookup tables baked from the gait settings curves.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 2, ClampMax = 1024))
+	int32 CurveTableResolution{64};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ForceInlineRow))
 	TMap<FGameplayTag, FAlsMovementStanceSettings> RotationModes
 	{
@@ -82,10 +108,51 @@ public:
 		{AlsRotationModeTags::Aiming, {}}
 	};
 
+private:
+	// Rotation modes and stances compiled into a dense table of gait settings, so that the gait settings can be
+	// resolved without nested map lookups. The table is indexed by rotation mode index and stance index. The gait
+	// settings are copied, since pointers to the map values would dangle after the maps are reallocated, for example on undo.
+
+	TArray<FGameplayTag> CompiledRotationModes;
+
+	TArray<FGameplayTag> CompiledStances;
+
+	TArray<FAlsMovementGaitSettings> CompiledGaitSettings;
+
+	// Indices of the compiled gait settings, indexed by rotation mode index and stance index.
+	TArray<int32> CompiledGaitSettingsIndices;
+
+	// Incremented each time the gait settings are compiled. Allows users to detect that the previously resolved gait settings are stale.
+	uint32 CompiledGaitSettingsRevision{0};
+
+#if WITH_EDITORONLY_DATA
+	uint64 CurvesCheckFrameNumber{0};
+#endif
+
 public:
+	virtual void PostInitProperties() override;
+
+	virtual void PostLoad() override;
+
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& ChangedEvent) override;
+
+	virtual void PostEditUndo() override;
+#endif
+
+private:
+	void CompileGaitSettings();
+
+public:
+#if WITH_EDITOR
+	// Curves may be edited in the editor without any notification to this asset, so this function checks,
+	// at most once per frame, whether the baked lookup tables are still up to date and recompiles them if not.
+	void RecompileGaitSettingsIfCurvesChanged();
 #endif
+
+	uint32 GetCompiledGaitSettingsRevision() const;
+
+	const FAlsMovementGaitSettings* FindGaitSettings(const FGameplayTag& RotationMode, const FGameplayTag& Stance) const;
 };
 
 inline float FAlsMovementGaitSettings::GetMaxWalkSpeed() const
@@ -101,3 +168,26 @@ inline float FAlsMovementGaitSettings::GetMaxRunSpeed() const
 		       ? FMath::Max(RunForwardSpeed, RunBackwardSpeed)
 		       : RunForwardSpeed;
 }
+
+inline uint32 UAlsMovementSettings::GetCompiledGaitSettingsRevision() const
+{
+	return CompiledGaitSettingsRevision;
+}
+
+inline bool FAlsMovementGaitSettings::TrySampleAccelerationAndDecelerationAndGroundFriction(
+	const float GaitAmount, FVector3f& OutValues) const
+{
+	const auto& Table{AccelerationAndDecelerationAndGroundFrictionTable};
+	if (Table.Num() < 2)
+	{
+		return false;
+	}
+
+	// Gait amount ranges from 0 to 3.
+
+	const auto Position{FMath::Clamp(GaitAmount, 0.0f, 3.0f) / 3.0f * static_cast<float>(Table.Num() - 1)};
+	const auto Index{FMath::Min(FMath::FloorToInt32(Position), Table.Num() - 2)};
+
+	OutValues = FMath::Lerp(Table[Index], Table[Index + 1], Position - static_cast<float>(Index));
+	return true;
+}
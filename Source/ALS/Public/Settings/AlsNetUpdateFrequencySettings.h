@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Engine/DataAsset.h"
+#include "AlsNetUpdateFrequencySettings.generated.h"
+
+UENUM(BlueprintType)
+enum class EAlsNetUpdateActivity : uint8
+{
+	Idle,
+	Turning,
+	Moving,
+	Sprinting,
+	Action,
+	Ragdolling
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsNetUpdateRate
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "Hz"))
+	float NetUpdateFrequency{10.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "Hz"))
+	float MinNetUpdateFrequency{2.0f};
+};
+
+UCLASS(Blueprintable, BlueprintType)
+class ALS_API UAlsNetUpdateFrequencySettings : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// Used when the character is not moving and is not performing any action.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsNetUpdateRate Idle{10.0f, 2.0f};
+
+	// Used when the character is not moving, but the view rotation is changing faster than the view yaw speed threshold.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsNetUpdateRate Turning{30.0f, 10.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsNetUpdateRate Moving{30.0f, 10.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsNetUpdateRate Sprinting{60.0f, 20.0f};
+
+	// Used when the character is performing any locomotion action other than ragdolling, such as rolling or mantling.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsNetUpdateRate Action{100.0f, 30.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	FAlsNetUpdateRate Ragdolling{60.0f, 30.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "deg/s"))
+	float ViewYawSpeedThreshold{90.0f};
+
+	// Switching to a higher rate happens immediately, while switching to a lower rate happens only
+	// after the lower rate activity has lasted for this time, to avoid flickering between rates.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float DemotionDelay{0.5f};
+
+public:
+	const FAlsNetUpdateRate& GetRate(EAlsNetUpdateActivity Activity) const;
+};
+
+inline const FAlsNetUpdateRate& UAlsNetUpdateFrequencySettings::GetRate(const EAlsNetUpdateActivity Activity) const
+{
+	switch (Activity)
+	{
+		case EAlsNetUpdateActivity::Turning:
+			return Turning;
+
+		case EAlsNetUpdateActivity::Moving:
+			return Moving;
+
+		case EAlsNetUpdateActivity::Sprinting:
+			return Sprinting;
+
+		case EAlsNetUpdateActivity::Action:
+			return Action;
+
+		case EAlsNetUpdateActivity::Ragdolling:
+			return Ragdolling;
+
+		default:
+			return Idle;
+	}
+}
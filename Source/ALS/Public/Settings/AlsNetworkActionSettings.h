@@ -0,0 +1,20 @@
+#pragma once
+
+#include "AlsNetworkActionSettings.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsNetworkActionSettings
+{
+	GENERATED_BODY()
+
+	// Action events are sent only to clients whose view location is within this distance from the
+	// character. Clients outside of this distance receive actions through the replicated state.
+	// Zero means that only the regular actor relevancy is taken into account.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float EventCullDistance{5000.0f};
+
+	// Action events that are older than this value on arrival are dropped. In this case the action is
+	// started from the replicated state instead, which is fast-forwarded by the time elapsed on the server.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float MaxEventAge{0.5f};
+};
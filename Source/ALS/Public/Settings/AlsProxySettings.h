@@ -0,0 +1,27 @@
+#pragma once
+
+#include "AlsProxySettings.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsProxySettings
+{
+	GENERATED_BODY()
+
+	// If checked, simulated proxies that are far from all local players refresh their state at a reduced rate
+	// and skip view network smoothing, input and mantling checks. Full updates resume once they get closer.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bEnableReducedUpdates : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, ForceUnits = "cm", EditCondition = "bEnableReducedUpdates"))
+	float ReducedUpdatesDistance{5000.0f};
+
+	// Prevents the character from switching back and forth between reduced and full updates near the distance threshold.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, ForceUnits = "cm", EditCondition = "bEnableReducedUpdates"))
+	float ReducedUpdatesDistanceHysteresis{500.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, ForceUnits = "Hz", EditCondition = "bEnableReducedUpdates"))
+	float ReducedUpdatesFrequency{10.0f};
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "AlsRewindSettings.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsRewindSettings
+{
+	GENERATED_BODY()
+
+	// If checked, the server records the history of the character's pose-relevant state, which can be used for hit validation.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 bEnableRewindHistory : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 0, ForceUnits = "s", EditCondition = "bEnableRewindHistory"))
+	float HistoryDuration{1.0f};
+
+	// Together with the history duration, determines the capacity of the history, which is allocated only once.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		Meta = (ClampMin = 1, ForceUnits = "Hz", EditCondition = "bEnableRewindHistory"))
+	float MaxRecordRate{60.0f};
+
+	// Bones whose world transforms are recorded along with the capsule. Only the first
+	// FAlsRewindSnapshot::MaxBones bones are recorded, the rest of the bones are ignored.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (EditCondition = "bEnableRewindHistory"))
+	TArray<FName> BoneNames;
+};
@@ -12,4 +12,18 @@ struct ALS_API FAlsViewSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS")
 	uint8 bEnableListenServerNetworkSmoothing : 1 {true};
+
+	// If checked, the view rotation of simulated proxies is extrapolated between network updates using the angular
+	// velocity calculated from the last two updates, which reduces the view lag when network updates are sparse.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS", Meta = (EditCondition = "bEnableNetworkSmoothing"))
+	uint8 bEnableNetworkExtrapolation : 1 {false};
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 0, ForceUnits = "s", EditCondition = "bEnableNetworkSmoothing && bEnableNetworkExtrapolation"))
+	float MaxNetworkExtrapolationTime{0.1f};
+
+	// Limits the extrapolation offset from the last received view rotation, so that mispredictions stay small.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "ALS",
+		Meta = (ClampMin = 0, ClampMax = 180, ForceUnits = "deg", EditCondition = "bEnableNetworkSmoothing && bEnableNetworkExtrapolation"))
+	float MaxNetworkExtrapolationAngle{15.0f};
 };
@@ -0,0 +1,16 @@
+﻿#pragma once
+
+#include "Engine/HitResult.h"
+
+// Not exposed to reflection, since it is written during the parallel animation evaluation and only read by native code.
+struct FAlsFootGroundHitState
+{
+	FName FootBoneName;
+
+	FHitResult Hit;
+
+	TEnumAsByte<ECollisionChannel> TraceChannel{ECC_Visibility};
+
+	// Value of GFrameCounter at the time the hit was recorded.
+	uint64 FrameNumber{0};
+};
@@ -9,4 +9,11 @@ struct ALS_API FAlsMantlingState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	int32 RootMotionSourceId = 0;
+
+	// Valid only on the server. The number of full mantling validation traces currently available to the owning client.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float ValidationTraceBudget{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	double ValidationTraceBudgetTime{0.0};
 };
@@ -30,4 +30,7 @@ struct ALS_API FAlsMovementBaseState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FRotator DeltaRotation{ForceInit};
+
+	// Set only for the movement base snapshot. Value of GFrameCounter at the time the snapshot was taken.
+	uint64 FrameNumber{0};
 };
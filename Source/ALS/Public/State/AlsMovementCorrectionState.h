@@ -0,0 +1,53 @@
+﻿#pragma once
+
+#include "AlsMovementCorrectionState.generated.h"
+
+// Corrections are always caused by a location error. The state change values only mark corrections of moves in
+// which the client changed its rotation mode, stance or max allowed gait, since such a change is a likely but
+// not a certain reason for the location error. Legitimate state changes don't result in corrections by themselves.
+UENUM(BlueprintType)
+enum class EAlsMovementCorrectionCause : uint8
+{
+	None,
+	LocationError,
+	RotationModeChange,
+	StanceChange,
+	MaxAllowedGaitChange
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsMovementCorrectionState
+{
+	GENERATED_BODY()
+
+	// Number of corrections sent to the autonomous proxy on the server, or received from the server on the autonomous proxy.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 CorrectionsCount{0};
+
+	// Valid only on the server. Number of corrections of moves in which the client
+	// changed its rotation mode, stance or max allowed gait.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 StateChangeCorrectionsCount{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	EAlsMovementCorrectionCause LastCorrectionCause{EAlsMovementCorrectionCause::None};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float LastCorrectionLocationError{0.0f};
+
+	// Valid only on autonomous proxies. Number of times the saved moves were replayed after a correction.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 ReplaysCount{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 LastReplayMovesCount{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	int32 MaxReplayMovesCount{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "ms"))
+	float LastReplayTime{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "ms"))
+	float MaxReplayTime{0.0f};
+};
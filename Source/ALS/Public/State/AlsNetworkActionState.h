@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Settings/AlsMantlingSettings.h"
+#include "Settings/AlsRollingSettings.h"
+#include "AlsNetworkActionState.generated.h"
+
+UENUM(BlueprintType)
+enum class EAlsNetworkActionType : uint8
+{
+	None,
+	Rolling,
+	Mantling,
+	Ragdolling
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsNetworkAction
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	EAlsNetworkActionType Type{EAlsNetworkActionType::None};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsRollingParameters RollingParameters;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsMantlingParameters MantlingParameters;
+};
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsNetworkActionState
+{
+	GENERATED_BODY()
+
+	// Incremented each time the server starts an action, so that two consecutive actions
+	// with the same parameters are still detected by simulated proxies. Never equals zero
+	// after the first action, so late joiners can tell an active action from the default state.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	uint8 Id{0};
+
+	// Action type is reset to none when the action ends, so late
+	// joiners only start actions that are still in progress.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsNetworkAction Action;
+
+	// Server world time at which the action started or stopped. Used by clients that receive the
+	// action late to fast-forward it, and to drop action events that are too old on arrival.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	float ServerTime{0.0f};
+};
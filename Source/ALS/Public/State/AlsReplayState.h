@@ -0,0 +1,22 @@
+﻿#pragma once
+
+#include "Engine/NetSerialization.h"
+#include "AlsReplayState.generated.h"
+
+// Compact mirror of the frequently changing character properties, replicated only to replays instead of them. It is updated only
+// when replays are recorded, and its values are quantized so that small changes don't generate new deltas in the replay stream.
+USTRUCT(BlueprintType)
+struct ALS_API FAlsReplayState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator ViewRotation{ForceInit};
+
+	// Compressed with FRotator::CompressAxisToShort(). Not exposed to blueprints, since they don't support uint16.
+	UPROPERTY(EditAnywhere, Category = "ALS")
+	uint16 DesiredVelocityYawAngle{0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector_NetQuantize RagdollTargetLocation{ForceInit};
+};
@@ -0,0 +1,97 @@
+﻿#pragma once
+
+#include "GameplayTagContainer.h"
+#include "AlsRewindState.generated.h"
+
+USTRUCT(BlueprintType)
+struct ALS_API FAlsRewindSnapshot
+{
+	GENERATED_BODY()
+
+	static constexpr auto MaxBones{4};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ForceUnits = "s"))
+	double ServerTime{0.0};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FVector Location{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FQuat Rotation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float CapsuleRadius{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float CapsuleHalfHeight{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator ViewRotation{ForceInit};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Stance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag LocomotionAction;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 4))
+	int32 BonesCount{0};
+
+	// World space transforms of the bones from the rewind settings. Not exposed
+	// to blueprints because blueprints don't support static arrays.
+	UPROPERTY(EditAnywhere, Category = "ALS")
+	FTransform BoneTransforms[MaxBones];
+};
+
+// Fixed capacity ring buffer of rewind snapshots. The memory is allocated only during initialization.
+class ALS_API FAlsRewindHistory
+{
+private:
+	TArray<FAlsRewindSnapshot> Snapshots;
+
+	int32 OldestIndex{0};
+
+	int32 SnapshotsCount{0};
+
+public:
+	void Initialize(int32 Capacity);
+
+	void Reset();
+
+	bool IsEmpty() const;
+
+	const FAlsRewindSnapshot& GetNewestSnapshot() const;
+
+	// Returns the slot for a new snapshot, overwriting the oldest snapshot if the history is full.
+	// Snapshots must be added in chronological order, since queries rely on it.
+	FAlsRewindSnapshot& AddSnapshot();
+
+	// Interpolates between the two snapshots surrounding the given time. Times
+	// outside the recorded range are clamped to the oldest or newest snapshot.
+	bool Query(double Time, FAlsRewindSnapshot& OutSnapshot) const;
+
+private:
+	// Index 0 corresponds to the oldest snapshot.
+	const FAlsRewindSnapshot& GetSnapshot(int32 Index) const;
+};
+
+inline void FAlsRewindHistory::Reset()
+{
+	OldestIndex = 0;
+	SnapshotsCount = 0;
+}
+
+inline bool FAlsRewindHistory::IsEmpty() const
+{
+	return SnapshotsCount <= 0;
+}
+
+inline const FAlsRewindSnapshot& FAlsRewindHistory::GetNewestSnapshot() const
+{
+	return GetSnapshot(SnapshotsCount - 1);
+}
+
+inline const FAlsRewindSnapshot& FAlsRewindHistory::GetSnapshot(const int32 Index) const
+{
+	return Snapshots[(OldestIndex + Index) % Snapshots.Num()];
+}
@@ -30,6 +30,14 @@ struct ALS_API FAlsViewNetworkSmoothingState
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FRotator CurrentRotation{ForceInit};
+
+	// Angular velocity in degrees per second, calculated from the last two server updates. Used for extrapolation.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FRotator AngularVelocity{ForceInit};
+
+	// Used for remembering how much time passed since the last server update, limited by the maximum extrapolation time.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float ExtrapolationTime{0.0f};
 };
 
 USTRUCT(BlueprintType)
@@ -211,6 +211,9 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = "ALS|Constants|Debug", Meta = (ReturnDisplayName = "Display Name"))
 	static const FName& MantlingDebugDisplayName();
+
+	UFUNCTION(BlueprintPure, Category = "ALS|Constants|Debug", Meta = (ReturnDisplayName = "Display Name"))
+	static const FName& CorrectionsDebugDisplayName();
 };
 
 inline const FName& UAlsConstants::RootBoneName()
@@ -590,3 +593,9 @@ inline const FName& UAlsConstants::MantlingDebugDisplayName()
 	static const FName Name{TEXTVIEW("ALS.Mantling")};
 	return Name;
 }
+
+inline const FName& UAlsConstants::CorrectionsDebugDisplayName()
+{
+	static const FName Name{TEXTVIEW("ALS.Corrections")};
+	return Name;
+}
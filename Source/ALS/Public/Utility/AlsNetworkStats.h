@@ -0,0 +1,35 @@
+﻿#pragma once
+
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+// Network traffic counters that allow measuring how much ALS costs on the wire. The stats can be viewed using the
+// "stat AlsNetwork" console command, and the per-function CSV stats can be recorded using the "csvprofile start"
+// console command with the "-csvCategories=AlsNetwork" command line argument, which produces a diffable CSV file.
+
+DECLARE_STATS_GROUP(TEXT("Als Network"), STATGROUP_AlsNetwork, STATCAT_Advanced)
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RPCs Executed"), STAT_AlsNetwork_RpcsExecuted, STATGROUP_AlsNetwork, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Packed Moves Sent"), STAT_AlsNetwork_PackedMovesSent, STATGROUP_AlsNetwork, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Packed Move Bits Sent"), STAT_AlsNetwork_PackedMoveBitsSent, STATGROUP_AlsNetwork, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mantling Validations"), STAT_AlsNetwork_MantlingValidations, STATGROUP_AlsNetwork, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mantling Validation Traces"), STAT_AlsNetwork_MantlingValidationTraces, STATGROUP_AlsNetwork, ALS_API)
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Mantling Rejections"), STAT_AlsNetwork_MantlingRejections, STATGROUP_AlsNetwork, ALS_API)
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(ALS_API, AlsNetwork);
+
+// Counts an execution of the RPC, should be placed at the beginning of its implementation.
+#define ALS_COUNT_RPC(FunctionName) \
+	do \
+	{ \
+		INC_DWORD_STAT(STAT_AlsNetwork_RpcsExecuted); \
+		CSV_CUSTOM_STAT(AlsNetwork, FunctionName, 1, ECsvCustomStatOp::Accumulate); \
+	} while (0)
+
+#define ALS_COUNT_NETWORK_STAT(StatName) \
+	do \
+	{ \
+		INC_DWORD_STAT(STAT_AlsNetwork_##StatName); \
+		CSV_CUSTOM_STAT(AlsNetwork, StatName, 1, ECsvCustomStatOp::Accumulate); \
+	} while (0)
+
@@ -1,9 +1,11 @@
 #include "AlsCameraComponent.h"
 
 #include "AlsCameraSettings.h"
+#include "AlsCharacter.h"
 #include "DrawDebugHelpers.h"
 #include "Animation/AnimInstance.h"
 #include "Engine/OverlapResult.h"
+#include "Engine/SkinnedAsset.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/WorldSettings.h"
 #include "Utility/AlsCameraConstants.h"
@@ -14,6 +16,10 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCameraComponent)
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Full Traces Skipped"), STAT_Als_CameraFullTracesSkipped, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Async Traces Used"), STAT_Als_CameraAsyncTracesUsed, STATGROUP_Als)
+DECLARE_DWORD_COUNTER_STAT(TEXT("Camera Socket Resolves"), STAT_Als_CameraSocketResolves, STATGROUP_Als)
+
 UAlsCameraComponent::UAlsCameraComponent()
 {
 	PrimaryComponentTick.bStartWithTickEnabled = false;
@@ -52,6 +58,8 @@ void UAlsCameraComponent::Activate(const bool bReset)
 {
 	if (bReset || ShouldActivate())
 	{
+		InvalidateTraceCache();
+
 		TickCamera(0.0f, false);
 	}
 
@@ -67,7 +75,7 @@ void UAlsCameraComponent::InitAnim(const bool bForceReinitialize)
 
 void UAlsCameraComponent::BeginPlay()
 {
-	ALS_ENSURE(IsValid(GetAnimInstance()));
+	ALS_ENSURE(IsUsingNativeCurves() || IsValid(GetAnimInstance()));
 	ALS_ENSURE(IsValid(Settings));
 	ALS_ENSURE(IsValid(Character));
 
@@ -90,9 +98,10 @@ void UAlsCameraComponent::TickComponent(float DeltaTime, const ELevelTick TickTy
 
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	// Skip camera tick until parallel animation evaluation completes.
+	// Skip camera tick until parallel animation evaluation completes. Native curves don't depend on the animation
+	// evaluation, and in pipelined mode the curves from the previous evaluation are used, so there is no need to wait for it.
 
-	if (!IsRunningParallelEvaluation())
+	if (IsUsingNativeCurves() || IsUsingPipelinedEvaluation() || !IsRunningParallelEvaluation())
 	{
 		TickCamera(DeltaTime);
 	}
@@ -102,40 +111,141 @@ void UAlsCameraComponent::CompleteParallelAnimationEvaluation(const bool bDoPost
 {
 	Super::CompleteParallelAnimationEvaluation(bDoPostAnimationEvaluation);
 
-	TickCamera(GetAnimInstance()->GetDeltaSeconds());
+	if (IsUsingNativeCurves())
+	{
+		return;
+	}
+
+	if (IsUsingPipelinedEvaluation())
+	{
+		// The camera has already been ticked this frame, so just store the new curves for the next frame.
+
+		RefreshCurveValues(GetAnimInstance()->GetDeltaSeconds(), true);
+	}
+	else
+	{
+		TickCamera(GetAnimInstance()->GetDeltaSeconds());
+	}
 }
 
-FVector UAlsCameraComponent::GetFirstPersonCameraLocation() const
+void UAlsCameraComponent::ResolveSocket(const USkeletalMeshComponent* Mesh, const FName& SocketName, FAlsCameraSocketCache& SocketCache)
 {
-	return Character->GetMesh()->GetSocketLocation(Settings->FirstPerson.CameraSocketName);
+	const auto* SkinnedAsset{Mesh->GetSkinnedAsset()};
+
+	if (!IsValid(SkinnedAsset) || Mesh->LeaderPoseComponent.IsValid())
+	{
+		// Follower components use the bone transforms of their leader, so use the regular socket lookup for them.
+
+		SocketCache.bValid = false;
+		return;
+	}
+
+	if (SocketCache.bValid && SocketCache.SkinnedAsset == SkinnedAsset && SocketCache.SocketName == SocketName)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_Als_CameraSocketResolves);
+
+	SocketCache.SkinnedAsset = SkinnedAsset;
+	SocketCache.SocketName = SocketName;
+	SocketCache.bValid = true;
+
+	auto SocketIndex{INDEX_NONE};
+
+	if (SkinnedAsset->FindSocketInfo(SocketName, SocketCache.BoneRelativeTransform, SocketCache.BoneIndex, SocketIndex) == nullptr)
+	{
+		SocketCache.BoneRelativeTransform = FTransform::Identity;
+		SocketCache.BoneIndex = Mesh->GetBoneIndex(SocketName);
+	}
 }
 
-FVector UAlsCameraComponent::GetThirdPersonPivotLocation() const
+FVector UAlsCameraComponent::GetCachedSocketLocation(const USkeletalMeshComponent* Mesh, const FName& SocketName,
+                                                     const FAlsCameraSocketCache& SocketCache)
+{
+	// The cache is only read here, so if it is stale, for example before the first TickCamera() call, use the regular socket lookup.
+
+	if (!SocketCache.bValid || SocketCache.SkinnedAsset != Mesh->GetSkinnedAsset() ||
+	    SocketCache.SocketName != SocketName || Mesh->LeaderPoseComponent.IsValid())
+	{
+		return Mesh->GetSocketLocation(SocketName);
+	}
+
+	const auto& ComponentSpaceTransforms{Mesh->GetComponentSpaceTransforms()};
+
+	if (!ComponentSpaceTransforms.IsValidIndex(SocketCache.BoneIndex))
+	{
+		return Mesh->GetSocketLocation(SocketName);
+	}
+
+	return Mesh->GetComponentTransform().TransformPosition(
+		ComponentSpaceTransforms[SocketCache.BoneIndex].TransformPosition(SocketCache.BoneRelativeTransform.GetLocation()));
+}
+
+void UAlsCameraComponent::RefreshSockets()
 {
 	const auto* Mesh{Character->GetMesh()};
 
-	FVector FirstPivotLocation;
+	// Read the locations of all sockets in one pass over the component space transforms.
+
+	const auto& ComponentSpaceTransforms{Mesh->GetComponentSpaceTransforms()};
+	const auto& ComponentTransform{Mesh->GetComponentTransform()};
+
+	const auto RefreshSocket{
+		[Mesh, &ComponentSpaceTransforms, &ComponentTransform](const FName& SocketName, FAlsCameraSocketCache& SocketCache)
+		{
+			ResolveSocket(Mesh, SocketName, SocketCache);
+
+			SocketCache.Location = SocketCache.bValid && ComponentSpaceTransforms.IsValidIndex(SocketCache.BoneIndex)
+				                       ? ComponentTransform.TransformPosition(ComponentSpaceTransforms[SocketCache.BoneIndex]
+					                       .TransformPosition(SocketCache.BoneRelativeTransform.GetLocation()))
+				                       : Mesh->GetSocketLocation(SocketName);
+		}
+	};
+
+	RefreshSocket(Settings->FirstPerson.CameraSocketName, FirstPersonCameraSocketCache);
+	RefreshSocket(Settings->ThirdPerson.FirstPivotSocketName, FirstPivotSocketCache);
+	RefreshSocket(Settings->ThirdPerson.SecondPivotSocketName, SecondPivotSocketCache);
+	RefreshSocket(Settings->ThirdPerson.TraceShoulderLeftSocketName, TraceShoulderLeftSocketCache);
+	RefreshSocket(Settings->ThirdPerson.TraceShoulderRightSocketName, TraceShoulderRightSocketCache);
+}
 
-	if (!IsValid(Mesh->GetAttachParent()) && Settings->ThirdPerson.FirstPivotSocketName == UAlsConstants::RootBoneName())
+FVector UAlsCameraComponent::CalculatePivotLocation(const FVector& FirstPivotSocketLocation, const FVector& SecondPivotSocketLocation) const
+{
+	if (!IsValid(Character->GetMesh()->GetAttachParent()) &&
+	    Settings->ThirdPerson.FirstPivotSocketName == UAlsConstants::RootBoneName())
 	{
 		// The root bone location usually remains fixed when the mesh is detached, so use the capsule's bottom location here as a fallback.
 
-		FirstPivotLocation = Character->GetRootComponent()->GetComponentLocation();
+		auto FirstPivotLocation{Character->GetRootComponent()->GetComponentLocation()};
 		FirstPivotLocation.Z -= Character->GetRootComponent()->Bounds.BoxExtent.Z;
-	}
-	else
-	{
-		FirstPivotLocation = Mesh->GetSocketLocation(Settings->ThirdPerson.FirstPivotSocketName);
+
+		return (FirstPivotLocation + SecondPivotSocketLocation) * 0.5f;
 	}
 
-	return (FirstPivotLocation + Mesh->GetSocketLocation(Settings->ThirdPerson.SecondPivotSocketName)) * 0.5f;
+	return (FirstPivotSocketLocation + SecondPivotSocketLocation) * 0.5f;
+}
+
+FVector UAlsCameraComponent::GetFirstPersonCameraLocation() const
+{
+	return GetCachedSocketLocation(Character->GetMesh(), Settings->FirstPerson.CameraSocketName, FirstPersonCameraSocketCache);
+}
+
+FVector UAlsCameraComponent::GetThirdPersonPivotLocation() const
+{
+	const auto* Mesh{Character->GetMesh()};
+
+	return CalculatePivotLocation(GetCachedSocketLocation(Mesh, Settings->ThirdPerson.FirstPivotSocketName, FirstPivotSocketCache),
+	                              GetCachedSocketLocation(Mesh, Settings->ThirdPerson.SecondPivotSocketName, SecondPivotSocketCache));
 }
 
 FVector UAlsCameraComponent::GetThirdPersonTraceStartLocation() const
 {
-	return Character->GetMesh()->GetSocketLocation(bRightShoulder
-		                                               ? Settings->ThirdPerson.TraceShoulderRightSocketName
-		                                               : Settings->ThirdPerson.TraceShoulderLeftSocketName);
+	return bRightShoulder
+		       ? GetCachedSocketLocation(Character->GetMesh(), Settings->ThirdPerson.TraceShoulderRightSocketName,
+		                                 TraceShoulderRightSocketCache)
+		       : GetCachedSocketLocation(Character->GetMesh(), Settings->ThirdPerson.TraceShoulderLeftSocketName,
+		                                 TraceShoulderLeftSocketCache);
 }
 
 void UAlsCameraComponent::GetViewInfo(FMinimalViewInfo& ViewInfo) const
@@ -157,16 +267,23 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UAlsCameraComponent::TickCamera"), STAT_UAlsCameraComponent_TickCamera, STATGROUP_Als)
 	TRACE_CPUPROFILER_EVENT_SCOPE(__FUNCTION__);
 
-	if (!IsValid(GetAnimInstance()) || !IsValid(Settings) || !IsValid(Character))
+	if (!IsValid(Settings) || !IsValid(Character) || (!Settings->bUseNativeCurves && !IsValid(GetAnimInstance())))
 	{
 		return;
 	}
 
-	ALS_ENSURE_MESSAGE(!IsRunningParallelEvaluation(),
+	ALS_ENSURE_MESSAGE(Settings->bUseNativeCurves || Settings->bUsePipelinedEvaluation || !IsRunningParallelEvaluation(),
 	                   TEXT("UAlsCameraComponent::TickCamera() should not be called during parallel animation")
 	                   TEXT(" evaluation, because accessing animation curves causes the game thread to wait")
 	                   TEXT(" for the parallel task to complete, resulting in performance degradation"));
 
+	// In pipelined mode, while the animation is still being evaluated, use the curves stored after the previous evaluation.
+
+	if (Settings->bUseNativeCurves || !IsRunningParallelEvaluation())
+	{
+		RefreshCurveValues(DeltaTime, bAllowLag);
+	}
+
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebugCameraShapes{
 		UAlsDebugUtility::ShouldDisplayDebugForActor(GetOwner(), UAlsCameraConstants::CameraShapesDebugDisplayName())
@@ -185,8 +302,15 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 
 	if (bMovementBaseHasRelativeRotation)
 	{
-		MovementBaseUtility::GetMovementBaseTransform(BasedMovement.MovementBase, BasedMovement.BoneName,
-		                                              MovementBaseLocation, MovementBaseRotation);
+		// Prefer the movement base snapshot taken by the character after the movement update, if it is up to date.
+
+		const auto* AlsCharacter{Cast<AAlsCharacter>(Character)};
+
+		if (!IsValid(AlsCharacter) || !AlsCharacter->TryGetCurrentMovementBaseTransform(MovementBaseLocation, MovementBaseRotation))
+		{
+			MovementBaseUtility::GetMovementBaseTransform(BasedMovement.MovementBase, BasedMovement.BoneName,
+			                                              MovementBaseLocation, MovementBaseRotation);
+		}
 	}
 
 	if (BasedMovement.MovementBase != MovementBasePrimitive || BasedMovement.BoneName != MovementBaseBoneName)
@@ -212,11 +336,11 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 
 	const auto PreviousPivotTargetLocation{PivotTargetLocation};
 
-	PivotTargetLocation = GetThirdPersonPivotLocation();
+	RefreshSockets();
 
-	const auto FirstPersonOverride{
-		UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FirstPersonOverrideCurveName()))
-	};
+	PivotTargetLocation = CalculatePivotLocation(FirstPivotSocketCache.Location, SecondPivotSocketCache.Location);
+
+	const auto FirstPersonOverride{UAlsMath::Clamp01(CurveValues.FirstPersonOverride)};
 
 	if (FAnimWeight::IsFullWeight(FirstPersonOverride))
 	{
@@ -225,7 +349,7 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 		PivotLagLocation = PivotTargetLocation;
 		PivotLocation = PivotTargetLocation;
 
-		CameraLocation = GetFirstPersonCameraLocation();
+		CameraLocation = FirstPersonCameraSocketCache.Location;
 		CameraRotation = CameraTargetRotation;
 
 		CameraFieldOfView = bOverrideFieldOfView ? FieldOfViewOverride : Settings->FirstPerson.FieldOfView;
@@ -319,7 +443,7 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	}
 	else
 	{
-		CameraLocation = FMath::Lerp(CameraFinalLocation, GetFirstPersonCameraLocation(), FirstPersonOverride);
+		CameraLocation = FMath::Lerp(CameraFinalLocation, FirstPersonCameraSocketCache.Location, FirstPersonOverride);
 		CameraFieldOfView = FMath::Lerp(Settings->ThirdPerson.FieldOfView, Settings->FirstPerson.FieldOfView, FirstPersonOverride);
 	}
 
@@ -331,6 +455,75 @@ void UAlsCameraComponent::TickCamera(const float DeltaTime, bool bAllowLag)
 	CameraFieldOfView = FMath::Clamp(CameraFieldOfView + CalculateFovOffset(), 5.0f, 175.0f);
 }
 
+void UAlsCameraComponent::RefreshCurveValues(const float DeltaTime, const bool bAllowLag)
+{
+	if (!Settings->bUseNativeCurves)
+	{
+		const auto* AnimInstance{GetAnimInstance()};
+
+		CurveValues.CameraOffsetX = AnimInstance->GetCurveValue(UAlsCameraConstants::CameraOffsetXCurveName());
+		CurveValues.CameraOffsetY = AnimInstance->GetCurveValue(UAlsCameraConstants::CameraOffsetYCurveName());
+		CurveValues.CameraOffsetZ = AnimInstance->GetCurveValue(UAlsCameraConstants::CameraOffsetZCurveName());
+		CurveValues.FovOffset = AnimInstance->GetCurveValue(UAlsCameraConstants::FovOffsetCurveName());
+		CurveValues.PivotOffsetX = AnimInstance->GetCurveValue(UAlsCameraConstants::PivotOffsetXCurveName());
+		CurveValues.PivotOffsetY = AnimInstance->GetCurveValue(UAlsCameraConstants::PivotOffsetYCurveName());
+		CurveValues.PivotOffsetZ = AnimInstance->GetCurveValue(UAlsCameraConstants::PivotOffsetZCurveName());
+		CurveValues.LocationLagX = AnimInstance->GetCurveValue(UAlsCameraConstants::LocationLagXCurveName());
+		CurveValues.LocationLagY = AnimInstance->GetCurveValue(UAlsCameraConstants::LocationLagYCurveName());
+		CurveValues.LocationLagZ = AnimInstance->GetCurveValue(UAlsCameraConstants::LocationLagZCurveName());
+		CurveValues.RotationLag = AnimInstance->GetCurveValue(UAlsCameraConstants::RotationLagCurveName());
+		CurveValues.FirstPersonOverride = AnimInstance->GetCurveValue(UAlsCameraConstants::FirstPersonOverrideCurveName());
+		CurveValues.TraceOverride = AnimInstance->GetCurveValue(UAlsCameraConstants::TraceOverrideCurveName());
+		return;
+	}
+
+	// Evaluate native curves from the same character state that is used by the camera animation instance.
+
+	const auto* AlsCharacter{Cast<AAlsCharacter>(Character)};
+	const auto& NativeCurves{Settings->NativeCurves};
+
+	const auto& TargetCurveValues{
+		IsValid(AlsCharacter)
+			? NativeCurves.FindCurves(AlsCharacter->GetViewMode(),
+			                          // In first-person mode, the rotation mode is always view direction, so use
+			                          // the desired rotation mode here, as the camera animation instance does.
+			                          AlsCharacter->GetViewMode() != AlsViewModeTags::FirstPerson
+				                          ? AlsCharacter->GetRotationMode()
+				                          : AlsCharacter->GetDesiredRotationMode(),
+			                          AlsCharacter->GetStance(), AlsCharacter->GetGait(), AlsCharacter->GetOverlayMode())
+			: NativeCurves.DefaultCurves
+	};
+
+	if (!bAllowLag || NativeCurves.BlendSpeed <= 0.0f)
+	{
+		CurveValues = TargetCurveValues;
+		return;
+	}
+
+	const auto BlendAlpha{UAlsMath::ExponentialDecay(DeltaTime, NativeCurves.BlendSpeed)};
+
+	const auto BlendCurveValue{
+		[BlendAlpha](float& Value, const float TargetValue)
+		{
+			Value = FMath::Lerp(Value, TargetValue, BlendAlpha);
+		}
+	};
+
+	BlendCurveValue(CurveValues.CameraOffsetX, TargetCurveValues.CameraOffsetX);
+	BlendCurveValue(CurveValues.CameraOffsetY, TargetCurveValues.CameraOffsetY);
+	BlendCurveValue(CurveValues.CameraOffsetZ, TargetCurveValues.CameraOffsetZ);
+	BlendCurveValue(CurveValues.FovOffset, TargetCurveValues.FovOffset);
+	BlendCurveValue(CurveValues.PivotOffsetX, TargetCurveValues.PivotOffsetX);
+	BlendCurveValue(CurveValues.PivotOffsetY, TargetCurveValues.PivotOffsetY);
+	BlendCurveValue(CurveValues.PivotOffsetZ, TargetCurveValues.PivotOffsetZ);
+	BlendCurveValue(CurveValues.LocationLagX, TargetCurveValues.LocationLagX);
+	BlendCurveValue(CurveValues.LocationLagY, TargetCurveValues.LocationLagY);
+	BlendCurveValue(CurveValues.LocationLagZ, TargetCurveValues.LocationLagZ);
+	BlendCurveValue(CurveValues.RotationLag, TargetCurveValues.RotationLag);
+	BlendCurveValue(CurveValues.FirstPersonOverride, TargetCurveValues.FirstPersonOverride);
+	BlendCurveValue(CurveValues.TraceOverride, TargetCurveValues.TraceOverride);
+}
+
 FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTargetRotation,
                                                       const float DeltaTime, const bool bAllowLag) const
 {
@@ -339,9 +532,7 @@ FRotator UAlsCameraComponent::CalculateCameraRotation(const FRotator& CameraTarg
 		return CameraTargetRotation;
 	}
 
-	const auto RotationLag{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::RotationLagCurveName())};
-
-	return UAlsRotation::ExponentialDecayRotation(CameraRotation, CameraTargetRotation, DeltaTime, RotationLag);
+	return UAlsRotation::ExponentialDecayRotation(CameraRotation, CameraTargetRotation, DeltaTime, CurveValues.RotationLag);
 }
 
 FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRotation, const float DeltaTime, const bool bAllowLag) const
@@ -354,44 +545,32 @@ FVector UAlsCameraComponent::CalculatePivotLagLocation(const FQuat& CameraYawRot
 	const auto RelativePivotInitialLagLocation{CameraYawRotation.UnrotateVector(PivotLagLocation)};
 	const auto RelativePivotTargetLocation{CameraYawRotation.UnrotateVector(PivotTargetLocation)};
 
-	const auto LocationLagX{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagXCurveName())};
-	const auto LocationLagY{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagYCurveName())};
-	const auto LocationLagZ{GetAnimInstance()->GetCurveValue(UAlsCameraConstants::LocationLagZCurveName())};
-
 	return CameraYawRotation.RotateVector({
-		UAlsMath::ExponentialDecay(RelativePivotInitialLagLocation.X, RelativePivotTargetLocation.X, DeltaTime, LocationLagX),
-		UAlsMath::ExponentialDecay(RelativePivotInitialLagLocation.Y, RelativePivotTargetLocation.Y, DeltaTime, LocationLagY),
-		UAlsMath::ExponentialDecay(RelativePivotInitialLagLocation.Z, RelativePivotTargetLocation.Z, DeltaTime, LocationLagZ)
+		UAlsMath::ExponentialDecay(RelativePivotInitialLagLocation.X, RelativePivotTargetLocation.X, DeltaTime, CurveValues.LocationLagX),
+		UAlsMath::ExponentialDecay(RelativePivotInitialLagLocation.Y, RelativePivotTargetLocation.Y, DeltaTime, CurveValues.LocationLagY),
+		UAlsMath::ExponentialDecay(RelativePivotInitialLagLocation.Z, RelativePivotTargetLocation.Z, DeltaTime, CurveValues.LocationLagZ)
 	});
 }
 
 FVector UAlsCameraComponent::CalculatePivotOffset() const
 {
 	return Character->GetMesh()->GetComponentQuat().RotateVector(
-		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetXCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetYCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::PivotOffsetZCurveName())
-		} * Character->GetMesh()->GetComponentScale().Z);
+		FVector{CurveValues.PivotOffsetX, CurveValues.PivotOffsetY, CurveValues.PivotOffsetZ} * Character->GetMesh()->GetComponentScale().Z);
 }
 
 FVector UAlsCameraComponent::CalculateCameraOffset() const
 {
 	return CameraRotation.RotateVector(
-		FVector{
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetXCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetYCurveName()),
-			GetAnimInstance()->GetCurveValue(UAlsCameraConstants::CameraOffsetZCurveName())
-		} * Character->GetMesh()->GetComponentScale().Z);
+		FVector{CurveValues.CameraOffsetX, CurveValues.CameraOffsetY, CurveValues.CameraOffsetZ} * Character->GetMesh()->GetComponentScale().Z);
 }
 
 float UAlsCameraComponent::CalculateFovOffset() const
 {
-	return GetAnimInstance()->GetCurveValue(UAlsCameraConstants::FovOffsetCurveName());
+	return CurveValues.FovOffset;
 }
 
 FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLocation, const FVector& PivotOffset,
-                                                  const float DeltaTime, const bool bAllowLag, float& NewTraceDistanceRatio) const
+                                                  const float DeltaTime, const bool bAllowLag, float& NewTraceDistanceRatio)
 {
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebugCameraTraces{
@@ -407,47 +586,78 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 
 	auto TraceStart{
 		FMath::Lerp(
-			GetThirdPersonTraceStartLocation(),
+			bRightShoulder ? TraceShoulderRightSocketCache.Location : TraceShoulderLeftSocketCache.Location,
 			PivotTargetLocation + PivotOffset + FVector{Settings->ThirdPerson.TraceOverrideOffset},
-			UAlsMath::Clamp01(GetAnimInstance()->GetCurveValue(UAlsCameraConstants::TraceOverrideCurveName())))
+			UAlsMath::Clamp01(CurveValues.TraceOverride))
 	};
 
 	const auto TraceEnd{CameraTargetLocation};
 	const auto CollisionShape{FCollisionShape::MakeSphere(Settings->ThirdPerson.TraceRadius * MeshScale)};
 
 	auto TraceResult{TraceEnd};
+	auto bBlockingHit{false};
 
-	FHitResult Hit;
-	if (GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
-	                                     CollisionShape, {MainTraceTag, false, GetOwner()}))
+	// Camera lag is disabled on teleport, in which case the asynchronous trace result can't be used.
+
+	if (!(bAllowLag && TryConsumeAsyncTrace(TraceStart, TraceEnd, TraceResult, bBlockingHit)) &&
+	    !TryTraceCoherently(TraceStart, TraceEnd, CollisionShape, TraceResult, bBlockingHit))
 	{
-		if (!Hit.bStartPenetrating)
-		{
-			TraceResult = Hit.Location;
-		}
-		else if (TryAdjustLocationBlockedByGeometry(TraceStart, bDisplayDebugCameraTraces))
-		{
-			static const FName AdjustedTraceTag{FString::Printf(TEXT("%hs (Adjusted Trace)"), __FUNCTION__)};
+		auto bTraceStartAdjusted{false};
 
-			GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
-			                                 CollisionShape, {AdjustedTraceTag, false, GetOwner()});
-			if (Hit.IsValidBlockingHit())
+		FHitResult Hit;
+		if (GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
+		                                     CollisionShape, {MainTraceTag, false, GetOwner()}))
+		{
+			if (!Hit.bStartPenetrating)
 			{
 				TraceResult = Hit.Location;
 			}
+			else if (TryAdjustLocationBlockedByGeometry(TraceStart, bDisplayDebugCameraTraces))
+			{
+				static const FName AdjustedTraceTag{FString::Printf(TEXT("%hs (Adjusted Trace)"), __FUNCTION__)};
+
+				bTraceStartAdjusted = true;
+
+				GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceEnd, FQuat::Identity, Settings->ThirdPerson.TraceChannel,
+				                                 CollisionShape, {AdjustedTraceTag, false, GetOwner()});
+				if (Hit.IsValidBlockingHit())
+				{
+					TraceResult = Hit.Location;
+				}
+			}
+			else
+			{
+				// Note that TraceStart may be changed even if TryAdjustLocationBlockedByGeometry() returned false.
+				bTraceStartAdjusted = true;
+				TraceResult = TraceStart;
+			}
+		}
+
+		bBlockingHit = Hit.IsValidBlockingHit();
+
+		// The result of a trace with an adjusted start location depends on all overlapping geometry, so don't reuse it.
+
+		if (bTraceStartAdjusted)
+		{
+			InvalidateTraceCache();
 		}
 		else
 		{
-			// Note that TraceStart may be changed even if TryAdjustLocationBlockedByGeometry() returned false.
-			TraceResult = TraceStart;
+			RefreshTraceCache(TraceStart, TraceEnd, CollisionShape, Hit);
 		}
 	}
 
+	// Request the trace for the next frame, predicting where the character will be by then.
+
+	const auto PredictedOffset{Character->GetVelocity() * DeltaTime};
+
+	RequestAsyncTrace(TraceStart + PredictedOffset, TraceEnd + PredictedOffset, CollisionShape, MeshScale);
+
 #if ENABLE_DRAW_DEBUG
 	if (bDisplayDebugCameraTraces)
 	{
 		UAlsDebugUtility::DrawSweepSphere(GetWorld(), TraceStart, TraceResult, CollisionShape.GetCapsuleRadius(),
-		                                  Hit.IsValidBlockingHit() ? FLinearColor::Red : FLinearColor::Green);
+		                                  bBlockingHit ? FLinearColor::Red : FLinearColor::Green);
 	}
 #endif
 
@@ -478,6 +688,241 @@ FVector UAlsCameraComponent::CalculateCameraTrace(const FVector& CameraTargetLoc
 	return TraceStart + TraceVector * TraceDistanceRatio;
 }
 
+bool UAlsCameraComponent::TryConsumeAsyncTrace(const FVector& TraceStart, const FVector& TraceEnd, FVector& TraceResult, bool& bBlockingHit)
+{
+	if (AsyncTrace.Handles.IsEmpty())
+	{
+		return false;
+	}
+
+	ON_SCOPE_EXIT
+	{
+		AsyncTrace.Handles.Reset();
+	};
+
+	const auto MaxLocationDelta{Settings->ThirdPerson.AsyncTrace.MaxLocationDelta};
+
+	if (!Settings->ThirdPerson.bEnableAsyncTrace ||
+	    !FVector::PointsAreNear(TraceStart, AsyncTrace.TraceStart, MaxLocationDelta) ||
+	    !FVector::PointsAreNear(TraceEnd, AsyncTrace.TraceEnd, MaxLocationDelta))
+	{
+		return false;
+	}
+
+	auto TraceRatio{1.0f};
+	auto bAnyBlockingHit{false};
+
+	FTraceDatum TraceDatum;
+
+	for (auto i{0}; i < AsyncTrace.Handles.Num(); i++)
+	{
+		if (!GetWorld()->QueryTraceData(AsyncTrace.Handles[i], TraceDatum))
+		{
+			return false;
+		}
+
+		const auto* Hit{TraceDatum.OutHits.FindByPredicate([](const FHitResult& OutHit)
+		{
+			return OutHit.IsValidBlockingHit();
+		})};
+
+		if (Hit == nullptr)
+		{
+			continue;
+		}
+
+		if (Hit->bStartPenetrating)
+		{
+			// A penetrating main trace requires the trace start location to be adjusted synchronously.
+
+			if (i == 0)
+			{
+				return false;
+			}
+
+			continue;
+		}
+
+		TraceRatio = FMath::Min(TraceRatio, Hit->Time);
+		bAnyBlockingHit = true;
+	}
+
+	// The results are applied to the actual trace as a ratio of the trace distance, since
+	// the actual trace locations may differ slightly from the predicted ones.
+
+	bBlockingHit = bAnyBlockingHit;
+	TraceResult = FMath::Lerp(TraceStart, TraceEnd, TraceRatio);
+
+	INC_DWORD_STAT(STAT_Als_CameraAsyncTracesUsed);
+	return true;
+}
+
+void UAlsCameraComponent::RequestAsyncTrace(const FVector& TraceStart, const FVector& TraceEnd,
+                                            const FCollisionShape& CollisionShape, const float MeshScale)
+{
+	AsyncTrace.Handles.Reset();
+
+	if (!Settings->ThirdPerson.bEnableAsyncTrace)
+	{
+		return;
+	}
+
+	const auto& AsyncTraceSettings{Settings->ThirdPerson.AsyncTrace};
+
+	AsyncTrace.TraceStart = TraceStart;
+	AsyncTrace.TraceEnd = TraceEnd;
+
+	static const FName AsyncTraceTag{FString::Printf(TEXT("%hs (Async Trace)"), __FUNCTION__)};
+
+	const FCollisionQueryParams QueryParams{AsyncTraceTag, false, GetOwner()};
+
+	// The main trace radius is increased by the maximum allowed location delta, so that the result
+	// remains conservative even if the actual trace locations differ from the predicted ones.
+
+	const auto MainTraceShape{FCollisionShape::MakeSphere(CollisionShape.GetSphereRadius() + AsyncTraceSettings.MaxLocationDelta)};
+
+	AsyncTrace.Handles.Emplace(GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd, FQuat::Identity,
+	                                                           Settings->ThirdPerson.TraceChannel, MainTraceShape, QueryParams));
+
+	if (AsyncTraceSettings.ProbeOffset <= 0.0f)
+	{
+		return;
+	}
+
+	const auto TraceRotation{(TraceEnd - TraceStart).ToOrientationQuat()};
+	const auto ProbeOffset{AsyncTraceSettings.ProbeOffset * MeshScale};
+	const auto ProbeShape{FCollisionShape::MakeSphere(AsyncTraceSettings.ProbeRadius * MeshScale)};
+
+	const FVector ProbeOffsets[]{
+		TraceRotation.GetRightVector() * -ProbeOffset,
+		TraceRotation.GetRightVector() * ProbeOffset,
+		TraceRotation.GetUpVector() * ProbeOffset
+	};
+
+	for (const auto& Offset : ProbeOffsets)
+	{
+		AsyncTrace.Handles.Emplace(GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, TraceStart, TraceEnd + Offset, FQuat::Identity,
+		                                                           Settings->ThirdPerson.TraceChannel, ProbeShape, QueryParams));
+	}
+}
+
+bool UAlsCameraComponent::TryTraceCoherently(const FVector& TraceStart, const FVector& TraceEnd, const FCollisionShape& CollisionShape,
+                                             FVector& TraceResult, bool& bBlockingHit)
+{
+	const auto& ThirdPersonSettings{Settings->ThirdPerson};
+	const auto& CoherentTraceSettings{ThirdPersonSettings.CoherentTrace};
+
+	if (!ThirdPersonSettings.bEnableCoherentTrace || !TraceCache.bValid ||
+	    TraceCache.TraceRadius != CollisionShape.GetSphereRadius() || TraceCache.TraceChannel != ThirdPersonSettings.TraceChannel ||
+	    GetWorld()->GetRealTimeSeconds() - TraceCache.Time > CoherentTraceSettings.MaxAge)
+	{
+		return false;
+	}
+
+	const auto LocationDelta{
+		UE_REAL_TO_FLOAT(FMath::Max(FVector::Dist(TraceStart, TraceCache.TraceStart), FVector::Dist(TraceEnd, TraceCache.TraceEnd)))
+	};
+
+	if (LocationDelta > CoherentTraceSettings.MaxLocationDelta)
+	{
+		return false;
+	}
+
+	if (TraceCache.bBlockingHit)
+	{
+		// Make sure that the blocking component still exists, still blocks the trace and hasn't moved since the last trace.
+
+		const auto* HitComponent{TraceCache.HitComponent.Get()};
+
+		if (!IsValid(HitComponent) || HitComponent->GetCollisionResponseToChannel(TraceCache.TraceChannel) != ECR_Block ||
+		    !HitComponent->GetComponentTransform().Equals(TraceCache.HitComponentTransform))
+		{
+			return false;
+		}
+	}
+
+	const auto TraceVector{TraceEnd - TraceStart};
+	const auto TraceDistance{UE_REAL_TO_FLOAT(TraceVector.Size())};
+
+	if (LocationDelta <= CoherentTraceSettings.LocationTolerance)
+	{
+		// The trace hasn't changed noticeably, so reuse the previous result without any queries.
+
+		bBlockingHit = TraceCache.bBlockingHit;
+
+		TraceResult = bBlockingHit && TraceDistance > UE_KINDA_SMALL_NUMBER
+			              ? TraceStart + TraceVector * (FMath::Min(TraceCache.HitDistance, TraceDistance) / TraceDistance)
+			              : TraceEnd;
+
+		INC_DWORD_STAT(STAT_Als_CameraFullTracesSkipped);
+		return true;
+	}
+
+	if (!TraceCache.bBlockingHit)
+	{
+		return false;
+	}
+
+	// The trace has moved slightly while being blocked, so sweep only up to just past the previous blocking distance.
+	// Any hit found by this sweep is also the first hit of the full sweep, so the full sweep is only needed on a miss.
+
+	const auto ShortTraceDistance{TraceCache.HitDistance + CoherentTraceSettings.MaxLocationDelta};
+
+	if (ShortTraceDistance >= TraceDistance)
+	{
+		return false;
+	}
+
+	static const FName ShortTraceTag{FString::Printf(TEXT("%hs (Short Trace)"), __FUNCTION__)};
+
+	FHitResult Hit;
+	if (!GetWorld()->SweepSingleByChannel(Hit, TraceStart, TraceStart + TraceVector * (ShortTraceDistance / TraceDistance),
+	                                      FQuat::Identity, TraceCache.TraceChannel, CollisionShape, {ShortTraceTag, false, GetOwner()}) ||
+	    Hit.bStartPenetrating)
+	{
+		return false;
+	}
+
+	bBlockingHit = true;
+	TraceResult = Hit.Location;
+
+	RefreshTraceCache(TraceStart, TraceEnd, CollisionShape, Hit);
+
+	INC_DWORD_STAT(STAT_Als_CameraFullTracesSkipped);
+	return true;
+}
+
+void UAlsCameraComponent::RefreshTraceCache(const FVector& TraceStart, const FVector& TraceEnd,
+                                            const FCollisionShape& CollisionShape, const FHitResult& Hit)
+{
+	TraceCache.bValid = Settings->ThirdPerson.bEnableCoherentTrace;
+
+	if (!TraceCache.bValid)
+	{
+		return;
+	}
+
+	const auto* HitComponent{Hit.GetComponent()};
+
+	TraceCache.TraceStart = TraceStart;
+	TraceCache.TraceEnd = TraceEnd;
+	TraceCache.bBlockingHit = Hit.IsValidBlockingHit();
+	TraceCache.HitComponent = TraceCache.bBlockingHit ? HitComponent : nullptr;
+	TraceCache.HitComponentTransform = TraceCache.bBlockingHit && IsValid(HitComponent)
+		                                   ? HitComponent->GetComponentTransform()
+		                                   : FTransform::Identity;
+	TraceCache.HitDistance = TraceCache.bBlockingHit ? UE_REAL_TO_FLOAT((Hit.Location - TraceStart).Size()) : 0.0f;
+	TraceCache.TraceRadius = CollisionShape.GetSphereRadius();
+	TraceCache.TraceChannel = Settings->ThirdPerson.TraceChannel;
+	TraceCache.Time = GetWorld()->GetRealTimeSeconds();
+}
+
+void UAlsCameraComponent::InvalidateTraceCache()
+{
+	TraceCache.bValid = false;
+	TraceCache.HitComponent.Reset();
+}
+
 bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location, const bool bDisplayDebugCameraTraces) const
 {
 	// Based on ComponentEncroachesBlockingGeometry_WithAdjustment().
@@ -485,7 +930,10 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 	const auto MeshScale{UE_REAL_TO_FLOAT(Character->GetMesh()->GetComponentScale().Z)};
 	const auto CollisionShape{FCollisionShape::MakeSphere((Settings->ThirdPerson.TraceRadius + 1.0f) * MeshScale)};
 
-	static TArray<FOverlapResult> Overlaps;
+	// The array is thread local, so that multiple cameras can safely call this function concurrently, while still
+	// reusing the allocated memory between calls. The check below guards against reentrancy on the same thread.
+
+	thread_local TArray<FOverlapResult> Overlaps;
 	check(Overlaps.IsEmpty())
 
 	ON_SCOPE_EXIT
@@ -503,6 +951,7 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 
 	auto Adjustment{FVector::ZeroVector};
 	auto bAnyValidBlock{false};
+	auto BlockingOverlapsCount{0};
 
 	FMTDResult MtdResult;
 
@@ -514,6 +963,15 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 			continue;
 		}
 
+		// Limit the amount of penetration computations, but still apply the adjustment accumulated so far,
+		// since failing the adjustment would pull the camera all the way into the trace start location.
+
+		if (Settings->ThirdPerson.MaxDepenetrationOverlaps > 0 &&
+		    ++BlockingOverlapsCount > Settings->ThirdPerson.MaxDepenetrationOverlaps)
+		{
+			break;
+		}
+
 		const auto* OverlapBody{Overlap.Component->GetBodyInstance(NAME_None, true, Overlap.ItemIndex)};
 
 		if (OverlapBody == nullptr || !OverlapBody->OverlapTest(Location, FQuat::Identity, CollisionShape, &MtdResult))
@@ -542,7 +1000,7 @@ bool UAlsCameraComponent::TryAdjustLocationBlockedByGeometry(FVector& Location,
 	}
 
 #if ENABLE_DRAW_DEBUG
-	if (bDisplayDebugCameraTraces)
+	if (bDisplayDebugCameraTraces && IsInGameThread())
 	{
 		DrawDebugLine(GetWorld(), Location, Location + Adjustment,
 		              FLinearColor{0.0f, 0.75f, 1.0f}.ToFColor(true),
@@ -118,19 +118,35 @@ void UAlsCameraComponent::DisplayDebugCurves(const UCanvas* Canvas, const float
 	const auto RowOffset{12.0f * Scale};
 	const auto ColumnOffset{145.0f * Scale};
 
-	TArray<FName> CurveNames;
-	GetAnimInstance()->GetAllCurveNames(CurveNames);
+	TArray<TPair<FName, float>> Curves;
 
-	CurveNames.Sort([](const FName& A, const FName& B)
+	if (IsUsingNativeCurves())
 	{
-		return A.LexicalLess(B);
+		for (TFieldIterator<FFloatProperty> Iterator{FAlsCameraCurveValues::StaticStruct()}; Iterator; ++Iterator)
+		{
+			Curves.Emplace(Iterator->GetFName(), Iterator->GetPropertyValue_InContainer(&CurveValues));
+		}
+	}
+	else if (IsValid(GetAnimInstance()))
+	{
+		TArray<FName> CurveNames;
+		GetAnimInstance()->GetAllCurveNames(CurveNames);
+
+		for (const auto& CurveName : CurveNames)
+		{
+			Curves.Emplace(CurveName, GetAnimInstance()->GetCurveValue(CurveName));
+		}
+	}
+
+	Curves.Sort([](const TPair<FName, float>& A, const TPair<FName, float>& B)
+	{
+		return A.Key.LexicalLess(B.Key);
 	});
 
 	TStringBuilder<32> CurveValueBuilder;
 
-	for (const auto& CurveName : CurveNames)
+	for (const auto& [CurveName, CurveValue] : Curves)
 	{
-		const auto CurveValue{GetAnimInstance()->GetCurveValue(CurveName)};
 
 		Text.SetColor(FMath::Lerp(FLinearColor::Gray, FLinearColor::White, UAlsMath::Clamp01(FMath::Abs(CurveValue))));
 
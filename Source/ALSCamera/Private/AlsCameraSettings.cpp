@@ -2,6 +2,50 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AlsCameraSettings)
 
+const FAlsCameraCurveValues& FAlsNativeCameraCurvesSettings::FindCurves(const FGameplayTag& ViewMode, const FGameplayTag& RotationMode,
+                                                                        const FGameplayTag& Stance, const FGameplayTag& Gait,
+                                                                        const FGameplayTag& OverlayMode) const
+{
+	const auto* Curves{&DefaultCurves};
+	auto MaxSpecificity{-1};
+
+	const auto TryMatchTag{
+		[](const FGameplayTag& EntryTag, const FGameplayTag& Tag, int32& Specificity)
+		{
+			if (!EntryTag.IsValid())
+			{
+				return true;
+			}
+
+			if (!Tag.MatchesTag(EntryTag))
+			{
+				return false;
+			}
+
+			Specificity += 1;
+			return true;
+		}
+	};
+
+	for (const auto& Entry : Entries)
+	{
+		auto Specificity{0};
+
+		if (TryMatchTag(Entry.ViewMode, ViewMode, Specificity) &&
+		    TryMatchTag(Entry.RotationMode, RotationMode, Specificity) &&
+		    TryMatchTag(Entry.Stance, Stance, Specificity) &&
+		    TryMatchTag(Entry.Gait, Gait, Specificity) &&
+		    TryMatchTag(Entry.OverlayMode, OverlayMode, Specificity) &&
+		    Specificity > MaxSpecificity)
+		{
+			Curves = &Entry.Curves;
+			MaxSpecificity = Specificity;
+		}
+	}
+
+	return *Curves;
+}
+
 #if WITH_EDITORONLY_DATA
 void UAlsCameraSettings::Serialize(FArchive& Archive)
 {
@@ -1,11 +1,62 @@
 #pragma once
 
+#include "AlsCameraSettings.h"
+#include "WorldCollision.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Utility/AlsMath.h"
 #include "AlsCameraComponent.generated.h"
 
-class UAlsCameraSettings;
 class ACharacter;
+class USkinnedAsset;
+
+struct ALSCAMERA_API FAlsCameraSocketCache
+{
+	TWeakObjectPtr<const USkinnedAsset> SkinnedAsset;
+
+	FName SocketName;
+
+	FTransform BoneRelativeTransform;
+
+	int32 BoneIndex{INDEX_NONE};
+
+	// World location of the socket read in the last batched pass over the component space transforms.
+	FVector Location{ForceInit};
+
+	bool bValid{false};
+};
+
+struct ALSCAMERA_API FAlsCameraAsyncTrace
+{
+	// The first handle is the main trace, the rest are the probes.
+	TArray<FTraceHandle, TInlineAllocator<4>> Handles;
+
+	FVector TraceStart{ForceInit};
+
+	FVector TraceEnd{ForceInit};
+};
+
+struct ALSCAMERA_API FAlsCameraTraceCache
+{
+	FVector TraceStart{ForceInit};
+
+	FVector TraceEnd{ForceInit};
+
+	TWeakObjectPtr<const UPrimitiveComponent> HitComponent;
+
+	FTransform HitComponentTransform;
+
+	float HitDistance{0.0f};
+
+	float TraceRadius{0.0f};
+
+	ECollisionChannel TraceChannel{ECC_Visibility};
+
+	double Time{0.0};
+
+	bool bBlockingHit{false};
+
+	bool bValid{false};
+};
 
 UCLASS(ClassGroup = "ALS", Meta = (BlueprintSpawnableComponent),
 	HideCategories = ("ComponentTick", "Clothing", "Physics", "MasterPoseComponent", "Collision", "AnimationRig",
@@ -38,6 +89,9 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient, Meta = (ForceUnits = "x"))
 	float PreviousGlobalTimeDilation{1.0f};
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
+	FAlsCameraCurveValues CurveValues;
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	FVector PivotTargetLocation{ForceInit};
 
@@ -74,6 +128,22 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State", Transient)
 	uint8 bRightShoulder : 1 {true};
 
+	FAlsCameraTraceCache TraceCache;
+
+	FAlsCameraAsyncTrace AsyncTrace;
+
+	// Character mesh sockets resolved to bone indices in TickCamera(), so that they don't have to be resolved by name every frame.
+
+	FAlsCameraSocketCache FirstPersonCameraSocketCache;
+
+	FAlsCameraSocketCache FirstPivotSocketCache;
+
+	FAlsCameraSocketCache SecondPivotSocketCache;
+
+	FAlsCameraSocketCache TraceShoulderLeftSocketCache;
+
+	FAlsCameraSocketCache TraceShoulderRightSocketCache;
+
 public:
 	UAlsCameraComponent();
 
@@ -126,9 +196,24 @@ public:
 	UFUNCTION(BlueprintPure, Category = "ALS|Camera")
 	void GetViewInfo(FMinimalViewInfo& ViewInfo) const;
 
+	bool IsUsingNativeCurves() const;
+
+	bool IsUsingPipelinedEvaluation() const;
+
 private:
+	static void ResolveSocket(const USkeletalMeshComponent* Mesh, const FName& SocketName, FAlsCameraSocketCache& SocketCache);
+
+	static FVector GetCachedSocketLocation(const USkeletalMeshComponent* Mesh, const FName& SocketName,
+	                                       const FAlsCameraSocketCache& SocketCache);
+
+	void RefreshSockets();
+
+	FVector CalculatePivotLocation(const FVector& FirstPivotSocketLocation, const FVector& SecondPivotSocketLocation) const;
+
 	void TickCamera(float DeltaTime, bool bAllowLag = true);
 
+	void RefreshCurveValues(float DeltaTime, bool bAllowLag);
+
 	FRotator CalculateCameraRotation(const FRotator& CameraTargetRotation, float DeltaTime, bool bAllowLag) const;
 
 	FVector CalculatePivotLagLocation(const FQuat& CameraYawRotation, float DeltaTime, bool bAllowLag) const;
@@ -140,7 +225,18 @@ private:
 	float CalculateFovOffset() const;
 
 	FVector CalculateCameraTrace(const FVector& CameraTargetLocation, const FVector& PivotOffset,
-	                             float DeltaTime, bool bAllowLag, float& NewTraceDistanceRatio) const;
+	                             float DeltaTime, bool bAllowLag, float& NewTraceDistanceRatio);
+
+	bool TryConsumeAsyncTrace(const FVector& TraceStart, const FVector& TraceEnd, FVector& TraceResult, bool& bBlockingHit);
+
+	void RequestAsyncTrace(const FVector& TraceStart, const FVector& TraceEnd, const FCollisionShape& CollisionShape, float MeshScale);
+
+	bool TryTraceCoherently(const FVector& TraceStart, const FVector& TraceEnd, const FCollisionShape& CollisionShape,
+	                        FVector& TraceResult, bool& bBlockingHit);
+
+	void RefreshTraceCache(const FVector& TraceStart, const FVector& TraceEnd, const FCollisionShape& CollisionShape, const FHitResult& Hit);
+
+	void InvalidateTraceCache();
 
 	bool TryAdjustLocationBlockedByGeometry(FVector& Location, bool bDisplayDebugCameraTraces) const;
 
@@ -190,6 +286,16 @@ inline void UAlsCameraComponent::SetPostProcessWeight(const float NewPostProcess
 	PostProcessWeight = UAlsMath::Clamp01(NewPostProcessWeight);
 }
 
+inline bool UAlsCameraComponent::IsUsingNativeCurves() const
+{
+	return IsValid(Settings) && Settings->bUseNativeCurves;
+}
+
+inline bool UAlsCameraComponent::IsUsingPipelinedEvaluation() const
+{
+	return IsValid(Settings) && Settings->bUsePipelinedEvaluation;
+}
+
 inline bool UAlsCameraComponent::IsRightShoulder() const
 {
 	return bRightShoulder;
@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "GameplayTagContainer.h"
 #include "Engine/DataAsset.h"
 #include "Engine/Scene.h"
 #include "Utility/AlsConstants.h"
@@ -26,6 +27,47 @@ struct ALSCAMERA_API FAlsTraceDistanceSmoothingSettings
 	float InterpolationSpeed{3.0f};
 };
 
+USTRUCT(BlueprintType)
+struct ALSCAMERA_API FAlsCoherentTraceSettings
+{
+	GENERATED_BODY()
+
+	// The previous trace result is reused without any queries while the trace start and end locations moved less than this distance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float LocationTolerance{0.5f};
+
+	// While blocked and moving farther than the tolerance, but less than this distance, only a short sweep
+	// up to the previous blocking distance plus this distance is performed instead of the full sweep.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float MaxLocationDelta{10.0f};
+
+	// Maximum time for which a trace result can be reused, so that new objects
+	// between the camera and the character are not ignored for too long.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float MaxAge{0.1f};
+};
+
+USTRUCT(BlueprintType)
+struct ALSCAMERA_API FAlsAsyncTraceSettings
+{
+	GENERATED_BODY()
+
+	// The asynchronous trace result is used only if the trace start and end locations predicted in the
+	// previous frame are closer than this distance to the actual ones, otherwise a synchronous trace is performed.
+	// The asynchronous trace radius is increased by this distance, so that the camera doesn't clip into geometry
+	// because of the prediction error. Keep it small compared to the trace radius to avoid pulling the camera in too much.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float MaxLocationDelta{5.0f};
+
+	// Offset of the left, right and up probes from the camera target location. The probes pull the camera
+	// in before the main trace gets blocked, which reduces pops near walls. If zero is specified, probes will be disabled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float ProbeOffset{25.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float ProbeRadius{5.0f};
+};
+
 USTRUCT(BlueprintType)
 struct ALSCAMERA_API FAlsThirdPersonCameraSettings
 {
@@ -55,12 +97,127 @@ struct ALSCAMERA_API FAlsThirdPersonCameraSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	FVector3f TraceOverrideOffset{0.0f, 0.0f, 40.0f};
 
+	// Maximum number of blocking overlaps considered when adjusting a trace start location blocked by geometry. The
+	// remaining overlaps are ignored, and the adjustment accumulated so far is used. If zero is specified, the number won't be limited.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", AdvancedDisplay, Meta = (ClampMin = 0))
+	int32 MaxDepenetrationOverlaps{8};
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (InlineEditConditionToggle))
 	uint8 bEnableTraceDistanceSmoothing : 1 {true};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
 		DisplayName = "Enable Trace Distance Smoothing", Meta = (EditCondition = "bEnableTraceDistanceSmoothing"))
 	FAlsTraceDistanceSmoothingSettings TraceDistanceSmoothing;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (InlineEditConditionToggle))
+	uint8 bEnableCoherentTrace : 1 {false};
+
+	// Allows reusing the previous frame's trace result while the trace and the blocking geometry remain almost unchanged.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		DisplayName = "Enable Coherent Trace", Meta = (EditCondition = "bEnableCoherentTrace"))
+	FAlsCoherentTraceSettings CoherentTrace;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (InlineEditConditionToggle))
+	uint8 bEnableAsyncTrace : 1 {false};
+
+	// Performs the camera trace asynchronously from the predicted trace locations and uses its result in the next
+	// frame, so the trace doesn't run on the game thread after the animation evaluation. Falls back to a synchronous trace on teleport.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS",
+		DisplayName = "Enable Async Trace", Meta = (EditCondition = "bEnableAsyncTrace"))
+	FAlsAsyncTraceSettings AsyncTrace;
+};
+
+// Values of the camera animation curves. Property names match the curve names from UAlsCameraConstants.
+USTRUCT(BlueprintType)
+struct ALSCAMERA_API FAlsCameraCurveValues
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float CameraOffsetX{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float CameraOffsetY{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float CameraOffsetZ{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float FovOffset{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float PivotOffsetX{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float PivotOffsetY{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	float PivotOffsetZ{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float LocationLagX{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float LocationLagY{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float LocationLagZ{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float RotationLag{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float FirstPersonOverride{0.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0, ClampMax = 1))
+	float TraceOverride{0.0f};
+};
+
+USTRUCT(BlueprintType)
+struct ALSCAMERA_API FAlsNativeCameraCurvesEntry
+{
+	GENERATED_BODY()
+
+	// Empty tags match any state. Parent tags match all of their child tags.
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag ViewMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag RotationMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Stance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag Gait;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FGameplayTag OverlayMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsCameraCurveValues Curves;
+};
+
+USTRUCT(BlueprintType)
+struct ALSCAMERA_API FAlsNativeCameraCurvesSettings
+{
+	GENERATED_BODY()
+
+	// The most specific matching entry is used. If several entries are equally specific, the first one is used.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	TArray<FAlsNativeCameraCurvesEntry> Entries;
+
+	// Curve values used when no entry matches the character state.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
+	FAlsCameraCurveValues DefaultCurves;
+
+	// Speed of blending between entries. If zero is specified, blending will be disabled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 0))
+	float BlendSpeed{5.0f};
+
+	const FAlsCameraCurveValues& FindCurves(const FGameplayTag& ViewMode, const FGameplayTag& RotationMode, const FGameplayTag& Stance,
+	                                        const FGameplayTag& Gait, const FGameplayTag& OverlayMode) const;
 };
 
 UCLASS(Blueprintable, BlueprintType)
@@ -72,6 +229,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	uint8 bIgnoreTimeDilation : 1 {true};
 
+	// If enabled, the camera won't wait for its parallel animation evaluation to complete, and will use the animation
+	// curves from the previous frame instead. This adds one frame of curve latency but removes the game thread stall.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
+	uint8 bUsePipelinedEvaluation : 1 {false};
+
 	// Camera will be teleported if the actor has moved farther than this
 	// distance in 1 frame. If zero is specified, teleportation will be disabled.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm"))
@@ -83,6 +245,15 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FAlsThirdPersonCameraSettings ThirdPerson;
 
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (InlineEditConditionToggle))
+	uint8 bUseNativeCurves : 1 {false};
+
+	// If enabled, camera curves are taken from these settings instead of the camera animation instance, so the camera
+	// doesn't have to wait for its animation evaluation. In this case, the camera doesn't need a skeletal mesh or an animation instance.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", DisplayName = "Use Native Curves",
+		Meta = (EditCondition = "bUseNativeCurves"))
+	FAlsNativeCameraCurvesSettings NativeCurves;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings")
 	FPostProcessSettings PostProcess;
 